@@ -0,0 +1,149 @@
+/*
+ * AgeMixing.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Contacts/Contacts.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Contacts;
+
+/*!
+ *  \brief A chunk of contacts to draw between two age groups, with its own random stream.
+ */
+struct MixingBlock {
+	unsigned int mFirstGroup;	//!< Age group of the first individual.
+	unsigned int mSecondGroup;	//!< Age group of the second individual.
+	unsigned long mBegin;		//!< Index of the first contact of the chunk.
+	unsigned long mEnd;			//!< Index past the last contact of the chunk.
+};
+
+/*!
+ *  \brief Task drawing the contacts of each chunk, chunks being distributed over threads.
+ */
+class MixingTask: public ParallelGen::Task {
+public:
+	MixingTask(const std::vector<std::vector<unsigned int> >& inMembers, const std::vector<MixingBlock>& inBlocks, unsigned long inSeed, ParallelGen::EdgeList& ioEdges) :
+		mMembers(inMembers),
+		mBlocks(inBlocks),
+		mSeed(inSeed),
+		mEdges(ioEdges)
+	{}
+
+	virtual void execute(unsigned int inThread, unsigned int inNbThreads) {
+		for (unsigned int c = inThread; c < mBlocks.size(); c += inNbThreads) {
+			Core::Randomizer lRandomizer(ParallelGen::getStreamSeed(mSeed, c));
+			const std::vector<unsigned int>& lFirst = mMembers[mBlocks[c].mFirstGroup];
+			const std::vector<unsigned int>& lSecond = mMembers[mBlocks[c].mSecondGroup];
+			for (unsigned long i = mBlocks[c].mBegin; i < mBlocks[c].mEnd; i++) {
+				unsigned int lIndividual1 = lFirst[lRandomizer.randInt(lFirst.size()-1)];
+				unsigned int lIndividual2 = lSecond[lRandomizer.randInt(lSecond.size()-1)];
+				if (lIndividual1 == lIndividual2) {
+					mEdges[i] = ParallelGen::getInvalidEdge();
+				} else {
+					mEdges[i] = ParallelGen::Edge(std::min(lIndividual1, lIndividual2), std::max(lIndividual1, lIndividual2));
+				}
+			}
+		}
+	}
+
+private:
+	const std::vector<std::vector<unsigned int> >& mMembers;
+	const std::vector<MixingBlock>& mBlocks;
+	unsigned long mSeed;
+	ParallelGen::EdgeList& mEdges;
+};
+
+/*!
+ * \brief  Generate contacts.
+ * \param  inPop Handle to the individuals to generate contacts for
+ * \param  inSystem Handle to the system
+ * \param  ioGraph Contact graph to build
+ * \throw  SCHNAPS::Core::RunTimeException if the mixing matrix is missing, not square or does not cover all age groups.
+ */
+void AgeMixing::generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbThreads = getNumberThreads(inSystem);
+	unsigned int lNbIndividuals = inPop->size();
+
+	if (inSystem->getParameters().hasParameter(MIXING_MATRIX_VARIABLE) == false) {
+		throw schnaps_RunTimeExceptionM("Parameter " + std::string(MIXING_MATRIX_VARIABLE) + " is required by contacts generator " + getName() + "!");
+	}
+	const Core::Vector& lMatrix = Core::castObjectT<const Core::Vector&>(inSystem->getParameters().getParameter(MIXING_MATRIX_VARIABLE));
+	unsigned int lNbGroups = (unsigned int)std::floor(std::sqrt((double)lMatrix.size()) + 0.5);
+	if (lNbGroups * lNbGroups != lMatrix.size()) {
+		throw schnaps_RunTimeExceptionM("Parameter " + std::string(MIXING_MATRIX_VARIABLE) + " must hold a square matrix!");
+	}
+
+	// members of each age group
+	std::vector<std::vector<unsigned int> > lMembers(lNbGroups);
+	for (unsigned int i = 0; i < lNbIndividuals; i++) {
+		unsigned int lAgeGroup = Core::castObjectT<const Core::UInt&>((*inPop)[i]->getState().getVariable(AGE_GROUP_VARIABLE)).getValue();
+		if (lAgeGroup >= lNbGroups) {
+			std::ostringstream lOSS;
+			lOSS << "Age group " << lAgeGroup << " is not covered by parameter " << MIXING_MATRIX_VARIABLE << "!";
+			throw schnaps_RunTimeExceptionM(lOSS.str());
+		}
+		lMembers[lAgeGroup].push_back(i);
+	}
+
+	// number of contacts between each pair of age groups, split in chunks
+	std::vector<MixingBlock> lBlocks;
+	unsigned long lNbEdges = 0;
+	for (unsigned int a = 0; a < lNbGroups; a++) {
+		for (unsigned int b = a; b < lNbGroups; b++) {
+			double lSizeA = lMembers[a].size();
+			double lSizeB = lMembers[b].size();
+			if (lSizeA == 0 || lSizeB == 0 || (a == b && lSizeA < 2)) {
+				continue;
+			}
+			double lMeanAB = Core::castHandleT<Core::Double>(lMatrix[a*lNbGroups+b])->getValue();
+			double lMeanBA = Core::castHandleT<Core::Double>(lMatrix[b*lNbGroups+a])->getValue();
+			// contacts are reciprocal, so both directions are averaged
+			double lExpected = a == b ? lSizeA * lMeanAB / 2 : (lSizeA * lMeanAB + lSizeB * lMeanBA) / 2;
+			double lMax = a == b ? lSizeA * (lSizeA - 1) / 2 : lSizeA * lSizeB;
+			lExpected = std::min(lExpected, lMax);
+			unsigned long lCount = (unsigned long)std::floor(lExpected);
+			if (inSystem->getRandomizer(0).rollUniform() < lExpected - lCount) {
+				lCount++;
+			}
+
+			for (unsigned long lBegin = 0; lBegin < lCount; lBegin += CONTACTS_CHUNK_SIZE) {
+				MixingBlock lBlock;
+				lBlock.mFirstGroup = a;
+				lBlock.mSecondGroup = b;
+				lBlock.mBegin = lNbEdges + lBegin;
+				lBlock.mEnd = lNbEdges + std::min(lCount, lBegin + CONTACTS_CHUNK_SIZE);
+				lBlocks.push_back(lBlock);
+			}
+			lNbEdges += lCount;
+		}
+	}
+
+	EdgeList lEdges(lNbEdges);
+	MixingTask lMixingTask(lMembers, lBlocks, rollMasterSeed(inSystem), lEdges);
+	runTask(lMixingTask, lNbThreads);
+
+	removeDuplicates(lEdges, lNbThreads);
+	ioGraph.build(lNbIndividuals, lEdges);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::AgeMixing::generate(SCHNAPS::Simulation::Individual::Bag::Handle, SCHNAPS::Core::System::Handle, SCHNAPS::Core::ContactGraph&) const");
+}
@@ -0,0 +1,61 @@
+/*
+ * AgeMixing.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Contacts_AgeMixing_hpp
+#define SCHNAPS_Plugins_Contacts_AgeMixing_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Contacts/ParallelGen.hpp"
+
+#define MIXING_MATRIX_VARIABLE "ref.contactsMixing"
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Contacts {
+
+/*!
+ *  \class AgeMixing SCHNAPS-plugins/Contacts/AgeMixing.hpp "SCHNAPS-plugins/Contacts/AgeMixing.hpp"
+ *  \brief Age-mixing (stochastic block model) algorithm. The parameter MIXING_MATRIX_VARIABLE is a vector
+ *  holding, row after row, the mean number of contacts an individual of age group a has with age group b.
+ *  Contacts between two age groups are drawn uniformly among their members; duplicates are removed.
+ */
+class AgeMixing: public ParallelGen {
+public:
+	//! AgeMixing allocator type.
+	typedef Core::AllocatorT<AgeMixing, ParallelGen::Alloc> Alloc;
+	//! AgeMixing handle type.
+	typedef Core::PointerT<AgeMixing, ParallelGen::Handle> Handle;
+	//! AgeMixing bag type.
+	typedef Core::ContainerT<AgeMixing, ParallelGen::Bag> Bag;
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Contacts_AgeMixing");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Contacts::AgeMixing::getName() const");
+	}
+
+	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const;
+};
+} // end of Contacts namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Contacts_AgeMixing_hpp */
@@ -26,12 +26,13 @@ using namespace Contacts;
 
 
 /*!
- * \brief  Generate contacts.
+ * \brief  Read the number of contacts of each individual, according to its age group.
  * \param  inPop Handle to the individuals to generate contacts for
  * \param  inSystem Handle to the system
- * \param  ioList List of contacts
+ * \param  outNbContacts Number of contacts of each individual
+ * \throw  SCHNAPS::Core::RunTimeException if the number of contacts of an age group is missing or too high.
  */
-void Base::generate(Simulation::Individual::Bag::Handle inPop,Core::System::Handle inSystem,std::vector<Core::Vector::Handle>& ioList) const {
+void Base::readNumberContacts(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<unsigned int>& outNbContacts) const {
 	schnaps_StackTraceBeginM();
 	Core::Vector::Handle lNbContactsVect;
 	if (inSystem->getParameters().hasParameter(NBCONTACTS_VARIABLE)) {
@@ -40,9 +41,8 @@ void Base::generate(Simulation::Individual::Bag::Handle inPop,Core::System::Hand
 		lNbContactsVect = NULL;
 	}
 	unsigned int lNbIndividuals=inPop->size();
-	std::vector<unsigned int> lListNbContacts(lNbIndividuals);
+	outNbContacts.resize(lNbIndividuals);
 	for (unsigned int i = 0; i < lNbIndividuals; i++) { //loop over all individuals to get their number of contacts
-		ioList[i]=new Core::Vector();
 		std::stringstream lSstm;
 		unsigned int lAgeGroup;
 		try {
@@ -55,39 +55,54 @@ void Base::generate(Simulation::Individual::Bag::Handle inPop,Core::System::Hand
 				if (lNbContactsVect->size() <= lAgeGroup) {
 					throw schnaps_RunTimeExceptionM("Age group error");
 				}
-				lListNbContacts[i] = Core::castHandleT<Core::UInt>((*lNbContactsVect)[lAgeGroup])->getValue();
+				outNbContacts[i] = Core::castHandleT<Core::UInt>((*lNbContactsVect)[lAgeGroup])->getValue();
 			} else {
 				lSstm << NBCONTACTS_VARIABLE << lAgeGroup;
-				lListNbContacts[i] = Core::castObjectT<const Core::UInt&>(inSystem->getParameters().getParameter(lSstm.str())).getValue();
+				outNbContacts[i] = Core::castObjectT<const Core::UInt&>(inSystem->getParameters().getParameter(lSstm.str())).getValue();
 			}
 		} catch (Core::RunTimeException) {
 			lSstm << " no number of contacts for this age group : " << lAgeGroup << ". Make sure you also have a variable " << AGE_GROUP_VARIABLE;
 			throw schnaps_RunTimeExceptionM(lSstm.str());
 		}
-		if (lListNbContacts[i] >= lNbIndividuals) {
+		if (outNbContacts[i] >= lNbIndividuals) {
 			throw schnaps_RunTimeExceptionM("Number of contacts must be lower than the number of individuals!");
 		}
 	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::Base::readNumberContacts(SCHNAPS::Simulation::Individual::Bag::Handle, SCHNAPS::Core::System::Handle, std::vector<unsigned int>&) const");
+}
+
+/*!
+ * \brief  Generate contacts.
+ * \param  inPop Handle to the individuals to generate contacts for
+ * \param  inSystem Handle to the system
+ * \param  ioGraph Contact graph to build
+ */
+void Base::generate(Simulation::Individual::Bag::Handle inPop,Core::System::Handle inSystem,Core::ContactGraph& ioGraph) const {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbIndividuals=inPop->size();
+	std::vector<unsigned int> lListNbContacts;
+	readNumberContacts(inPop, inSystem, lListNbContacts);
+	std::vector<std::vector<unsigned int> > lList(lNbIndividuals);
+	for (unsigned int i = 0; i < lNbIndividuals; i++) {
+		lList[i].reserve(lListNbContacts[i]);
+	}
+	// lMark[k] == i+1 when k is already a contact of individual i, so duplicates are found in constant time
+	std::vector<unsigned int> lMark(lNbIndividuals, 0);
 	for (unsigned int i = 0; i < lNbIndividuals; i++) { //loop over all individuals to generate their contacts
 		unsigned int lExtra = i+1 < lNbIndividuals ? 0 : 1;
+		for (unsigned int k = 0; k < lList[i].size(); k++) {
+			lMark[lList[i][k]] = i+1;
+		}
 		// it is not always possible to arrive to the good number of contacts for each individual
 		// we will sometimes need to tolerate an extra
-		for (unsigned int j = ioList[i]->size(); j < lListNbContacts[i]; j++){ //loop over all contacts to be generated
+		for (unsigned int j = lList[i].size(); j < lListNbContacts[i]; j++){ //loop over all contacts to be generated
 			unsigned int lIndividual = inSystem->getRandomizer(0).rollInteger(lExtra == 0 ? i+1 : 0, lNbIndividuals-1);
 			for (unsigned int lCount=1;;lCount++){ //loop until a contact is found
-				if (ioList[lIndividual]->size() < lListNbContacts[lIndividual]+lExtra) {
-					if (i != lIndividual) {
-						bool lValid = true;
-						for (unsigned int k = 0; k < j; k++) { //loop over all contacts already generated to check if they are already in the list
-							if (Core::castHandleT<Core::UInt>((*(ioList[i]))[k])->getValue() == lIndividual) {
-								lValid = false; //Can't have the same contact twice
-								break;
-							}
-						}
-						if (lValid) {
-							//valid contact found
-							break;
-						}
+				if (lList[lIndividual].size() < lListNbContacts[lIndividual]+lExtra) {
+					//Can't have the same contact twice
+					if (i != lIndividual && lMark[lIndividual] != i+1) {
+						//valid contact found
+						break;
 					}
 				}
 				
@@ -105,11 +120,11 @@ void Base::generate(Simulation::Individual::Bag::Handle inPop,Core::System::Hand
 				}
 			}
 			// add to both contact lists
-			ioList[i]->push_back(new Core::UInt(lIndividual));
-			ioList[lIndividual]->push_back(new Core::UInt(i));
+			lList[i].push_back(lIndividual);
+			lList[lIndividual].push_back(i);
+			lMark[lIndividual] = i+1;
 		}
 	}
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::Base::generate(Simulation::Individual::Bag::Handle inPop) const");
+	ioGraph.build(lList);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::Base::generate(SCHNAPS::Simulation::Individual::Bag::Handle, SCHNAPS::Core::System::Handle, SCHNAPS::Core::ContactGraph&) const");
 }
-
-
@@ -51,7 +51,11 @@ public:
 		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Contacts::Base::getName() const");
 	}
 
-	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<Core::Vector::Handle>& ioList) const;
+	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const;
+
+protected:
+	//! Read the number of contacts of each individual.
+	void readNumberContacts(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<unsigned int>& outNbContacts) const;
 
 };
 } // end of Contacts namespace
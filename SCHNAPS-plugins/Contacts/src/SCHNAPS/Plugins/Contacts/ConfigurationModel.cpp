@@ -0,0 +1,122 @@
+/*
+ * ConfigurationModel.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Contacts/Contacts.hpp"
+
+#include <algorithm>
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Contacts;
+
+/*!
+ *  \brief Task assigning a random key to each contact stub, one chunk of individuals at a time.
+ */
+class StubTask: public ParallelGen::Task {
+public:
+	StubTask(const std::vector<unsigned long>& inOffsets, unsigned long inSeed, ParallelGen::EdgeList& ioStubs) :
+		mOffsets(inOffsets),
+		mSeed(inSeed),
+		mStubs(ioStubs)
+	{}
+
+	virtual void execute(unsigned int inThread, unsigned int inNbThreads) {
+		unsigned int lNbIndividuals = mOffsets.size()-1;
+		unsigned int lNbChunks = (lNbIndividuals + CONTACTS_CHUNK_SIZE - 1) / CONTACTS_CHUNK_SIZE;
+		for (unsigned int c = inThread; c < lNbChunks; c += inNbThreads) {
+			Core::Randomizer lRandomizer(ParallelGen::getStreamSeed(mSeed, c));
+			unsigned int lEnd = std::min(lNbIndividuals, (c+1) * CONTACTS_CHUNK_SIZE);
+			for (unsigned int i = c * CONTACTS_CHUNK_SIZE; i < lEnd; i++) {
+				for (unsigned long j = mOffsets[i]; j < mOffsets[i+1]; j++) {
+					mStubs[j] = ParallelGen::Edge(lRandomizer.randInt(), i);
+				}
+			}
+		}
+	}
+
+private:
+	const std::vector<unsigned long>& mOffsets;
+	unsigned long mSeed;
+	ParallelGen::EdgeList& mStubs;
+};
+
+/*!
+ *  \brief Task pairing consecutive shuffled stubs into contacts, one slice per thread.
+ */
+class PairTask: public ParallelGen::Task {
+public:
+	PairTask(const ParallelGen::EdgeList& inStubs, ParallelGen::EdgeList& ioEdges) :
+		mStubs(inStubs),
+		mEdges(ioEdges)
+	{}
+
+	virtual void execute(unsigned int inThread, unsigned int inNbThreads) {
+		unsigned long lBegin = mEdges.size() * inThread / inNbThreads;
+		unsigned long lEnd = mEdges.size() * (inThread+1) / inNbThreads;
+		for (unsigned long i = lBegin; i < lEnd; i++) {
+			unsigned int lFirst = mStubs[2*i].second;
+			unsigned int lSecond = mStubs[2*i+1].second;
+			if (lFirst == lSecond) {
+				mEdges[i] = ParallelGen::getInvalidEdge();
+			} else {
+				mEdges[i] = ParallelGen::Edge(std::min(lFirst, lSecond), std::max(lFirst, lSecond));
+			}
+		}
+	}
+
+private:
+	const ParallelGen::EdgeList& mStubs;
+	ParallelGen::EdgeList& mEdges;
+};
+
+/*!
+ * \brief  Generate contacts.
+ * \param  inPop Handle to the individuals to generate contacts for
+ * \param  inSystem Handle to the system
+ * \param  ioGraph Contact graph to build
+ */
+void ConfigurationModel::generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbThreads = getNumberThreads(inSystem);
+	unsigned int lNbIndividuals = inPop->size();
+
+	std::vector<unsigned int> lListNbContacts;
+	readNumberContacts(inPop, inSystem, lListNbContacts);
+	std::vector<unsigned long> lOffsets(lNbIndividuals+1, 0);
+	for (unsigned int i = 0; i < lNbIndividuals; i++) {
+		lOffsets[i+1] = lOffsets[i] + lListNbContacts[i];
+	}
+
+	// shuffle stubs by sorting them on random keys
+	EdgeList lStubs(lOffsets.back());
+	StubTask lStubTask(lOffsets, rollMasterSeed(inSystem), lStubs);
+	runTask(lStubTask, lNbThreads);
+	sortEdges(lStubs, lNbThreads);
+
+	// pair consecutive stubs (an odd stub is left alone)
+	EdgeList lEdges(lStubs.size() / 2);
+	PairTask lPairTask(lStubs, lEdges);
+	runTask(lPairTask, lNbThreads);
+	EdgeList().swap(lStubs);
+
+	removeDuplicates(lEdges, lNbThreads);
+	ioGraph.build(lNbIndividuals, lEdges);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::ConfigurationModel::generate(SCHNAPS::Simulation::Individual::Bag::Handle, SCHNAPS::Core::System::Handle, SCHNAPS::Core::ContactGraph&) const");
+}
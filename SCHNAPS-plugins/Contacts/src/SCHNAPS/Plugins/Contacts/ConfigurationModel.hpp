@@ -0,0 +1,59 @@
+/*
+ * ConfigurationModel.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Contacts_ConfigurationModel_hpp
+#define SCHNAPS_Plugins_Contacts_ConfigurationModel_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Contacts/ParallelGen.hpp"
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Contacts {
+
+/*!
+ *  \class ConfigurationModel SCHNAPS-plugins/Contacts/ConfigurationModel.hpp "SCHNAPS-plugins/Contacts/ConfigurationModel.hpp"
+ *  \brief Configuration model: each individual gets as many contact stubs as its age group number of contacts,
+ *  and stubs are paired at random. Self-contacts and duplicate contacts are removed, so some individuals may end
+ *  up with slightly less contacts than requested.
+ */
+class ConfigurationModel: public ParallelGen {
+public:
+	//! ConfigurationModel allocator type.
+	typedef Core::AllocatorT<ConfigurationModel, ParallelGen::Alloc> Alloc;
+	//! ConfigurationModel handle type.
+	typedef Core::PointerT<ConfigurationModel, ParallelGen::Handle> Handle;
+	//! ConfigurationModel bag type.
+	typedef Core::ContainerT<ConfigurationModel, ParallelGen::Bag> Bag;
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Contacts_ConfigurationModel");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Contacts::ConfigurationModel::getName() const");
+	}
+
+	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const;
+};
+} // end of Contacts namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Contacts_ConfigurationModel_hpp */
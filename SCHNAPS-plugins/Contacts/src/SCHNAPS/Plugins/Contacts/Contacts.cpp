@@ -5,6 +5,8 @@
 SCHNAPS_Plugin_BeginDefinitionM("Contacts", "1.0.0");
 
 SCHNAPS_Plugin_AddAllocM("Contacts_Base", SCHNAPS::Plugins::Contacts::Base::Alloc);
+SCHNAPS_Plugin_AddAllocM("Contacts_ConfigurationModel", SCHNAPS::Plugins::Contacts::ConfigurationModel::Alloc);
+SCHNAPS_Plugin_AddAllocM("Contacts_AgeMixing", SCHNAPS::Plugins::Contacts::AgeMixing::Alloc);
 SCHNAPS_Plugin_AddAllocM("Contacts_Transmission", SCHNAPS::Plugins::Contacts::Transmission::Alloc);
 
 
@@ -3,6 +3,10 @@
 #define Contacts_hpp
 
 #include "SCHNAPS/Plugins/Contacts/Base.hpp"
+#include "SCHNAPS/Plugins/Contacts/ParallelGen.hpp"
+#include "SCHNAPS/Plugins/Contacts/ContactsThread.hpp"
+#include "SCHNAPS/Plugins/Contacts/ConfigurationModel.hpp"
+#include "SCHNAPS/Plugins/Contacts/AgeMixing.hpp"
 #include "SCHNAPS/Plugins/Contacts/Transmission.hpp"
 
 
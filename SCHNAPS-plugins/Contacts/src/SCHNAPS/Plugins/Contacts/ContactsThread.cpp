@@ -0,0 +1,53 @@
+/*
+ * ContactsThread.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Contacts/Contacts.hpp"
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Contacts;
+
+/*!
+ * \brief Construct and start a thread.
+ * \param inTask A pointer to the task to execute.
+ * \param inThread Index of the thread.
+ * \param inNbThreads Total number of threads executing the task.
+ */
+ContactsThread::ContactsThread(ParallelGen::Task* inTask, unsigned int inThread, unsigned int inNbThreads) :
+	mTask(inTask),
+	mThread(inThread),
+	mNbThreads(inNbThreads)
+{
+	run();
+}
+
+/*!
+ * \brief Wait for the end of the thread.
+ */
+ContactsThread::~ContactsThread() {
+	wait();
+}
+
+/*!
+ * \brief Execute the part of the task associated to the thread.
+ */
+void ContactsThread::main() {
+	mTask->execute(mThread, mNbThreads);
+}
@@ -0,0 +1,61 @@
+/*
+ * ContactsThread.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Contacts_ContactsThread_hpp
+#define SCHNAPS_Plugins_Contacts_ContactsThread_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Contacts/ParallelGen.hpp"
+
+#include "PACC/PACC.hpp"
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Contacts {
+
+/*!
+ *  \class ContactsThread SCHNAPS-plugins/Contacts/ContactsThread.hpp "SCHNAPS-plugins/Contacts/ContactsThread.hpp"
+ *  \brief Thread executing its part of a contacts generation task. It starts on construction and is joined on destruction.
+ */
+class ContactsThread: public Core::Object, public PACC::Threading::Thread {
+public:
+	//! ContactsThread allocator type.
+	typedef Core::AllocatorT<ContactsThread, Core::Object::Alloc> Alloc;
+	//! ContactsThread handle type.
+	typedef Core::PointerT<ContactsThread, Core::Object::Handle> Handle;
+	//! ContactsThread bag type.
+	typedef Core::ContainerT<ContactsThread, Core::Object::Bag> Bag;
+
+	ContactsThread(ParallelGen::Task* inTask, unsigned int inThread, unsigned int inNbThreads);
+	~ContactsThread();
+
+protected:
+	virtual void main();
+
+private:
+	ParallelGen::Task* mTask;	//!< Task to execute.
+	unsigned int mThread;		//!< Index of the thread.
+	unsigned int mNbThreads;	//!< Total number of threads executing the task.
+};
+} // end of Contacts namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Contacts_ContactsThread_hpp */
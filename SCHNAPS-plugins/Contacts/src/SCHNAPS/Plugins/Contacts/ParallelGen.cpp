@@ -0,0 +1,169 @@
+/*
+ * ParallelGen.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Contacts/Contacts.hpp"
+
+#include <algorithm>
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Contacts;
+
+/*!
+ *  \brief Task sorting one slice of a list of contacts per thread.
+ */
+class SortTask: public ParallelGen::Task {
+public:
+	SortTask(ParallelGen::EdgeList& ioEdges, const std::vector<unsigned long>& inBounds) :
+		mEdges(ioEdges),
+		mBounds(inBounds)
+	{}
+
+	virtual void execute(unsigned int inThread, unsigned int inNbThreads) {
+		std::sort(mEdges.begin() + mBounds[inThread], mEdges.begin() + mBounds[inThread+1]);
+	}
+
+private:
+	ParallelGen::EdgeList& mEdges;
+	const std::vector<unsigned long>& mBounds;
+};
+
+/*!
+ *  \brief Task merging pairs of adjacent sorted slices of a list of contacts, one pair per thread.
+ */
+class MergeTask: public ParallelGen::Task {
+public:
+	MergeTask(ParallelGen::EdgeList& ioEdges, const std::vector<unsigned long>& inBounds, unsigned int inWidth) :
+		mEdges(ioEdges),
+		mBounds(inBounds),
+		mWidth(inWidth)
+	{}
+
+	virtual void execute(unsigned int inThread, unsigned int inNbThreads) {
+		unsigned int lNbSlices = mBounds.size()-1;
+		for (unsigned int lFirst = 2*mWidth*inThread; lFirst + mWidth < lNbSlices; lFirst += 2*mWidth*inNbThreads) {
+			unsigned int lLast = std::min(lFirst + 2*mWidth, lNbSlices);
+			std::inplace_merge(mEdges.begin() + mBounds[lFirst], mEdges.begin() + mBounds[lFirst+mWidth], mEdges.begin() + mBounds[lLast]);
+		}
+	}
+
+private:
+	ParallelGen::EdgeList& mEdges;
+	const std::vector<unsigned long>& mBounds;
+	unsigned int mWidth;
+};
+
+/*!
+ * \brief Run a task over multiple threads and wait for its completion.
+ * \param ioTask A reference to the task to run.
+ * \param inNbThreads Number of threads.
+ */
+void ParallelGen::runTask(Task& ioTask, unsigned int inNbThreads) {
+	schnaps_StackTraceBeginM();
+	if (inNbThreads <= 1) {
+		ioTask.execute(0, 1);
+	} else {
+		ContactsThread::Bag lThreads;
+		for (unsigned int i = 0; i < inNbThreads; i++) {
+			lThreads.push_back(new ContactsThread(&ioTask, i, inNbThreads));
+		}
+		// threads are joined when destroyed
+		lThreads.clear();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::ParallelGen::runTask(SCHNAPS::Plugins::Contacts::ParallelGen::Task&, unsigned int)");
+}
+
+/*!
+ * \brief Sort a list of contacts.
+ * \param ioEdges A reference to the list of contacts.
+ * \param inNbThreads Number of threads used to sort.
+ *
+ * Slices are sorted in parallel, then merged pairwise in parallel.
+ */
+void ParallelGen::sortEdges(EdgeList& ioEdges, unsigned int inNbThreads) {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbSlices = std::max(1u, std::min<unsigned int>(inNbThreads, ioEdges.size() / CONTACTS_CHUNK_SIZE));
+	std::vector<unsigned long> lBounds(lNbSlices+1);
+	for (unsigned int i = 0; i <= lNbSlices; i++) {
+		lBounds[i] = ioEdges.size() * i / lNbSlices;
+	}
+
+	SortTask lSortTask(ioEdges, lBounds);
+	runTask(lSortTask, lNbSlices);
+	for (unsigned int lWidth = 1; lWidth < lNbSlices; lWidth *= 2) {
+		MergeTask lMergeTask(ioEdges, lBounds, lWidth);
+		runTask(lMergeTask, (lNbSlices + 2*lWidth - 1) / (2*lWidth));
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::ParallelGen::sortEdges(SCHNAPS::Plugins::Contacts::ParallelGen::EdgeList&, unsigned int)");
+}
+
+/*!
+ * \brief Sort contacts, remove duplicates and contacts marked as invalid.
+ * \param ioEdges A reference to the list of contacts, each one having its lowest index first.
+ * \param inNbThreads Number of threads used to sort.
+ */
+void ParallelGen::removeDuplicates(EdgeList& ioEdges, unsigned int inNbThreads) {
+	schnaps_StackTraceBeginM();
+	sortEdges(ioEdges, inNbThreads);
+	ioEdges.erase(std::unique(ioEdges.begin(), ioEdges.end()), ioEdges.end());
+	// invalid contacts are sorted last
+	while (!ioEdges.empty() && ioEdges.back() == getInvalidEdge()) {
+		ioEdges.pop_back();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::ParallelGen::removeDuplicates(SCHNAPS::Plugins::Contacts::ParallelGen::EdgeList&, unsigned int)");
+}
+
+/*!
+ * \brief  Return the seed of a specific random stream, mixing the master seed with the stream index.
+ * \param  inSeed Master seed.
+ * \param  inStream Index of the stream.
+ * \return The seed of the stream (never 0, which would seed the randomizer from the clock).
+ */
+unsigned long ParallelGen::getStreamSeed(unsigned long inSeed, unsigned int inStream) {
+	schnaps_StackTraceBeginM();
+	unsigned long lSeed = (inSeed ^ (0x9E3779B9UL * (inStream + 1))) & 0xFFFFFFFFUL;
+	lSeed = ((lSeed >> 16) ^ lSeed) * 0x45D9F3BUL & 0xFFFFFFFFUL;
+	lSeed = ((lSeed >> 16) ^ lSeed) * 0x45D9F3BUL & 0xFFFFFFFFUL;
+	lSeed = (lSeed >> 16) ^ lSeed;
+	return lSeed == 0 ? 1 : lSeed;
+	schnaps_StackTraceEndM("unsigned long SCHNAPS::Plugins::Contacts::ParallelGen::getStreamSeed(unsigned long, unsigned int)");
+}
+
+/*!
+ * \brief  Return the number of generation threads.
+ * \param  inSystem Handle to the system
+ * \return The number of generation threads.
+ */
+unsigned int ParallelGen::getNumberThreads(Core::System::Handle inSystem) const {
+	schnaps_StackTraceBeginM();
+	return Core::castObjectT<const Core::UInt&>(inSystem->getParameters().getParameter("threads.generator")).getValue();
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Contacts::ParallelGen::getNumberThreads(SCHNAPS::Core::System::Handle) const");
+}
+
+/*!
+ * \brief  Draw the master seed of the random streams from the generation randomizer.
+ * \param  inSystem Handle to the system
+ * \return The master seed.
+ */
+unsigned long ParallelGen::rollMasterSeed(Core::System::Handle inSystem) const {
+	schnaps_StackTraceBeginM();
+	return inSystem->getRandomizer(0).rollInteger(1, UINT_MAX);
+	schnaps_StackTraceEndM("unsigned long SCHNAPS::Plugins::Contacts::ParallelGen::rollMasterSeed(SCHNAPS::Core::System::Handle) const");
+}
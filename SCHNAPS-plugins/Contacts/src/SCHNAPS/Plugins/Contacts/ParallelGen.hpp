@@ -0,0 +1,104 @@
+/*
+ * ParallelGen.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2012 by Xavier Douville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Contacts_ParallelGen_hpp
+#define SCHNAPS_Plugins_Contacts_ParallelGen_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Contacts/Base.hpp"
+
+#include <utility>
+#include <vector>
+
+// number of individuals (or contacts) handled with the same random stream
+#define CONTACTS_CHUNK_SIZE 16384
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Contacts {
+
+/*!
+ *  \class ParallelGen SCHNAPS-plugins/Contacts/ParallelGen.hpp "SCHNAPS-plugins/Contacts/ParallelGen.hpp"
+ *  \brief Base class of contacts generators that build the graph with multiple threads.
+ *
+ *  Work is split in fixed-size chunks, each one using its own random stream seeded from the
+ *  generation randomizer, so that the generated network does not depend on the number of threads.
+ */
+class ParallelGen: public Base {
+public:
+	//! ParallelGen allocator type.
+	typedef Core::AbstractAllocT<ParallelGen, Base::Alloc> Alloc;
+	//! ParallelGen handle type.
+	typedef Core::PointerT<ParallelGen, Base::Handle> Handle;
+	//! ParallelGen bag type.
+	typedef Core::ContainerT<ParallelGen, Base::Bag> Bag;
+
+	//! A reciprocal contact between two individuals.
+	typedef std::pair<unsigned int, unsigned int> Edge;
+	//! A list of reciprocal contacts.
+	typedef std::vector<Edge> EdgeList;
+
+	/*!
+	 *  \class Task SCHNAPS-plugins/Contacts/ParallelGen.hpp "SCHNAPS-plugins/Contacts/ParallelGen.hpp"
+	 *  \brief Work executed by each generation thread.
+	 */
+	class Task {
+	public:
+		virtual ~Task() {}
+
+		//! Execute the part of the work associated to a specific thread.
+		virtual void execute(unsigned int inThread, unsigned int inNbThreads) = 0;
+	};
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Contacts_ParallelGen");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Contacts::ParallelGen::getName() const");
+	}
+
+	//! Run a task over multiple threads and wait for its completion.
+	static void runTask(Task& ioTask, unsigned int inNbThreads);
+	//! Sort a list of contacts.
+	static void sortEdges(EdgeList& ioEdges, unsigned int inNbThreads);
+	//! Sort contacts, remove duplicates and self-contacts.
+	static void removeDuplicates(EdgeList& ioEdges, unsigned int inNbThreads);
+	//! Return the seed of a specific random stream.
+	static unsigned long getStreamSeed(unsigned long inSeed, unsigned int inStream);
+
+	/*!
+	 * \brief  Return the contact used to mark an invalid draw (e.g. a self-contact), removed by removeDuplicates.
+	 * \return The contact used to mark an invalid draw.
+	 */
+	static Edge getInvalidEdge() {
+		return Edge(UINT_MAX, UINT_MAX);
+	}
+
+protected:
+	//! Return the number of generation threads.
+	unsigned int getNumberThreads(Core::System::Handle inSystem) const;
+	//! Draw the master seed of the random streams from the generation randomizer.
+	unsigned long rollMasterSeed(Core::System::Handle inSystem) const;
+};
+} // end of Contacts namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Contacts_ParallelGen_hpp */
@@ -20,6 +20,8 @@
 
 #include "SCHNAPS/Plugins/Contacts/Contacts.hpp"
 
+#include <cmath>
+
 using namespace SCHNAPS;
 using namespace Plugins;
 using namespace Contacts;
@@ -239,31 +241,30 @@ Core::AnyType::Handle Transmission::execute(unsigned int inIndex, Core::Executio
 	Simulation::SimulationContext& lContext = Core::castObjectT<Simulation::SimulationContext&>(ioContext);
     
 	double lProbability;
-	unsigned int lIndividual;
 	
-	Core::Vector::Handle lContacts;
+	Core::AnyType::Handle lContacts;
 
 	switch (mContacts_Ref[0]) {
 		case '@':
 			// individual variable value
-			lContacts = Core::castHandleT<Core::Vector>(lContext.getIndividual().getState().getVariableHandle(mContacts_Ref.substr(1)));
+			lContacts = lContext.getIndividual().getState().getVariableHandle(mContacts_Ref.substr(1));
 			break;
 		case '#':
 			// environment variable value
-			lContacts = Core::castHandleT<Core::Vector>(lContext.getIndividual().getState().getVariableHandle(mContacts_Ref.substr(1))->clone());
+			lContacts = lContext.getIndividual().getState().getVariableHandle(mContacts_Ref.substr(1))->clone();
 			break;
 		case '%':
 			// local variable value
-			lContacts = Core::castHandleT<Core::Vector>(lContext.getLocalVariableHandle(mContacts_Ref.substr(1)));
+			lContacts = lContext.getLocalVariableHandle(mContacts_Ref.substr(1));
 			break;
 		case '$':
-			// parameter value
-			lContacts = Core::castHandleT<Core::Vector>(mContacts->clone());
+			// parameter value (read-only, no copy needed)
+			lContacts = mContacts;
 			break;
 		default:
 			// direct value
 			//do not contain a direct contact list, but a string refering to an individual variable to be created by the generator.
-			lContacts = Core::castHandleT<Core::Vector>(lContext.getIndividual().getState().getVariableHandle(mContacts_Ref));
+			lContacts = lContext.getIndividual().getState().getVariableHandle(mContacts_Ref);
 			break;
 	}
 	
@@ -285,16 +286,29 @@ Core::AnyType::Handle Transmission::execute(unsigned int inIndex, Core::Executio
 			break;
 	}
 	unsigned long lDelay=1;
-	unsigned long lDelta=1;
 	unsigned long lStartValue = lContext.getClock().getValue(Simulation::Clock::eOther) + lDelay;
-	for (unsigned int i = 0; i < lContacts->size(); i++) {
-		double lRandom = ioContext.getRandomizer().rollUniform();
-		if (lRandom < lProbability) {
-			lIndividual = Core::castHandleT<Core::UInt>((*lContacts)[i])->getValue();
-			lContext.getPushList().push_back(Simulation::Push(mLabel, Simulation::Process::eIndividualByID, lContext.getClock().getTick(lStartValue, Simulation::Clock::eOther),lIndividual));		
+	unsigned long lTick = lContext.getClock().getTick(lStartValue, Simulation::Clock::eOther);
+	
+	std::vector<unsigned int> lTargets;
+	if (lContacts->getType() == "ContactList") {
+		// read neighbours straight from the contact graph
+		const Core::ContactList& lList = Core::castObjectT<const Core::ContactList&>(*lContacts);
+		sampleContacts(lList.size(), lProbability, ioContext.getRandomizer(), lTargets);
+		for (unsigned int i = 0; i < lTargets.size(); i++) {
+			lTargets[i] = lList[lTargets[i]];
 		}
-		
-	}	
+	} else {
+		const Core::Vector& lList = Core::castObjectT<const Core::Vector&>(*lContacts);
+		sampleContacts(lList.size(), lProbability, ioContext.getRandomizer(), lTargets);
+		for (unsigned int i = 0; i < lTargets.size(); i++) {
+			lTargets[i] = Core::castHandleT<Core::UInt>(lList[lTargets[i]])->getValue();
+		}
+	}
+	
+	// all infected contacts receive the process at the same time, so a single push is enough
+	if (lTargets.empty() == false) {
+		lContext.getPushList().push_back(Simulation::Push(mLabel, lTick, lTargets));
+	}
 
 	return NULL;
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Plugins::Contacts::Transmission::execute(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
@@ -312,3 +326,40 @@ const std::string& Transmission::getReturnType(unsigned int inIndex, Core::Execu
 	return lType;
 	schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Contacts::Transmission::getReturnType(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
+
+/*!
+ * \brief Draw the indexes of contacts infected independently with a specific probability.
+ * \param inNbContacts Number of contacts.
+ * \param inProbability Probability of infecting each contact.
+ * \param ioRandomizer A reference to the randomizer.
+ * \param outIndexes Indexes of the infected contacts, in increasing order.
+ *
+ * Gaps between infected contacts follow a geometric law, so only one draw per infected contact
+ * (plus one) is needed instead of one draw per contact.
+ */
+void Transmission::sampleContacts(unsigned int inNbContacts, double inProbability, Core::Randomizer& ioRandomizer, std::vector<unsigned int>& outIndexes) const {
+	schnaps_StackTraceBeginM();
+	outIndexes.clear();
+	if (inNbContacts == 0 || inProbability <= 0) {
+		return;
+	}
+	if (inProbability >= 1) {
+		outIndexes.resize(inNbContacts);
+		for (unsigned int i = 0; i < inNbContacts; i++) {
+			outIndexes[i] = i;
+		}
+		return;
+	}
+	
+	double lLogComplement = std::log(1 - inProbability);
+	double lIndex = -1;
+	while (true) {
+		// 1 - U lies in (0, 1], so the logarithm is defined
+		lIndex += 1 + std::floor(std::log(1 - ioRandomizer.rollUniform()) / lLogComplement);
+		if (lIndex >= inNbContacts) {
+			break;
+		}
+		outIndexes.push_back((unsigned int)lIndex);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Contacts::Transmission::sampleContacts(unsigned int, double, SCHNAPS::Core::Randomizer&, std::vector<unsigned int>&) const");
+}
@@ -71,6 +71,9 @@ public:
 	virtual const std::string& getReturnType(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
 
 private:
+	//! Draw the indexes of infected contacts.
+	void sampleContacts(unsigned int inNbContacts, double inProbability, Core::Randomizer& ioRandomizer, std::vector<unsigned int>& outIndexes) const;
+
 	std::string mLabel;					//!< Label of process to push
 	std::string mContacts_Ref;			//!< Reference to contacts of the individual.
 	Core::Vector::Handle mContacts;		//!< A handle to the contacts of the individual.
@@ -30,7 +30,8 @@ using namespace Control;
 BranchMulti::BranchMulti() :
 	Primitive(),	// unknown number of children
 	mProbabilities_Ref(""),
-	mProbabilities(NULL)
+	mProbabilities(NULL),
+	mAliasTable(NULL)
 {}
 
 /*!
@@ -48,14 +49,19 @@ BranchMulti::BranchMulti(const BranchMulti& inOriginal) :
 		case '%':
 			// local variable value
 			mProbabilities = NULL;
+			mAliasTable = NULL;
 			break;
 		case '$':
 			// parameter value
 			mProbabilities = inOriginal.mProbabilities;
+			// sampler is only rebuilt (under lock) when parameters change, share it
+			mAliasTable = inOriginal.mAliasTable;
 			break;
 		default:
 			// direct value
 			mProbabilities = Core::castHandleT<Core::Vector>(inOriginal.mProbabilities->clone());
+			// sampler is never modified, share it
+			mAliasTable = inOriginal.mAliasTable;
 			break;
 	}
 	setNumberArguments(inOriginal.getNumberArguments());
@@ -77,14 +83,19 @@ BranchMulti& BranchMulti::operator=(const BranchMulti& inOriginal) {
 		case '%':
 			// local variable value
 			mProbabilities = NULL;
+			mAliasTable = NULL;
 			break;
 		case '$':
 			// parameter value
 			mProbabilities = inOriginal.mProbabilities;
+			// sampler is only rebuilt (under lock) when parameters change, share it
+			mAliasTable = inOriginal.mAliasTable;
 			break;
 		default:
 			// direct value
 			mProbabilities = Core::castHandleT<Core::Vector>(inOriginal.mProbabilities->clone());
+			// sampler is never modified, share it
+			mAliasTable = inOriginal.mAliasTable;
 			break;
 	}
 	setNumberArguments(inOriginal.getNumberArguments());
@@ -131,6 +142,8 @@ void BranchMulti::readWithSystem(PACC::XML::ConstIterator inIter, Core::System&
 		case '$':
 			// parameter value
 			mProbabilities = Core::castHandleT<Core::Vector>(ioSystem.getParameters().getParameterHandle(mProbabilities_Ref.substr(1)));
+			// sampler built at first execution, and rebuilt when parameters change
+			mAliasTable = new Core::AliasTable();
 			break;
 		default: {
 			// direct value
@@ -140,13 +153,18 @@ void BranchMulti::readWithSystem(PACC::XML::ConstIterator inIter, Core::System&
 			
 			std::string lProbability;
 			double lSum = 0;
+			std::vector<double> lWeights;
 
 			mProbabilities = new Core::Vector();
 			while (lTokenizer.getNextToken(lProbability)) {
 				mProbabilities->push_back(new Core::Double(SCHNAPS::str2dbl(lProbability)));
 				lSum += SCHNAPS::str2dbl(lProbability);
+				lWeights.push_back(SCHNAPS::str2dbl(lProbability));
 			}
 			
+			// probabilities are constant, build sampler once
+			mAliasTable = new Core::AliasTable(lWeights);
+			
 #ifndef SCHNAPS_NDEBUG
 			if (lSum != 1) {
 				std::cout << "Warning: multi branches probabilities must sum to 1 (current sum: " <<  lSum << "!";
@@ -178,39 +196,19 @@ void BranchMulti::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) c
  */
 Core::AnyType::Handle BranchMulti::execute(unsigned int inIndex, Core::ExecutionContext& ioContext) const {
 	schnaps_StackTraceBeginM();
-	Simulation::ExecutionContext& lContext = Core::castObjectT<Simulation::ExecutionContext&>(ioContext);
-	Core::Vector::Handle lProbabilities;
-	Core::RouletteT<unsigned int> lRoulette;
+	unsigned int lBranch;
 	
 	switch (mProbabilities_Ref[0]) {
-		case '@':
-			// individual variable value
-			lProbabilities = Core::castHandleT<Core::Vector>(lContext.getIndividual().getState().getVariableHandle(mProbabilities_Ref.substr(1)));
-			break;
-		case '#':
-			// environment variable value
-			lProbabilities = Core::castHandleT<Core::Vector>(lContext.getIndividual().getState().getVariableHandle(mProbabilities_Ref.substr(1))->clone());
-			break;
-		case '%':
-			// local variable value
-			lProbabilities = Core::castHandleT<Core::Vector>(lContext.getLocalVariableHandle(mProbabilities_Ref.substr(1)));
-			break;
 		case '$':
-			// parameter value
-			lProbabilities = Core::castHandleT<Core::Vector>(mProbabilities->clone());
+			// parameter value (table rebuilt only if parameters changed)
+			lBranch = mAliasTable->select(*mProbabilities, ioContext.getSystem().getParameters().getVersion(), ioContext.getRandomizer());
 			break;
 		default:
 			// direct value
-			lProbabilities = mProbabilities;
+			lBranch = mAliasTable->select(ioContext.getRandomizer());
 			break;
 	}
-	
-	Core::Double::Handle lProbability;
-	for (unsigned int i = 0; i < lProbabilities->size(); i++) {
-	    lProbability = Core::castHandleT<Core::Double>((*lProbabilities)[i]);
-		lRoulette.insert(i, lProbability->getValue());
-	}
-	return getArgument(inIndex, lRoulette.select(ioContext.getRandomizer()), ioContext);
+	return getArgument(inIndex, lBranch, ioContext);
 	schnaps_StackTraceEndM("Core::AnyType::Handle SCHNAPS::Plugins::Control::BranchMulti::execute(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
 
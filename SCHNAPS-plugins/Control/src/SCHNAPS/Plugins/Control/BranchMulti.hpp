@@ -75,6 +75,7 @@ public:
 private:
 	std::string mProbabilities_Ref;			//!< Reference to probabilities.
 	Core::Vector::Handle mProbabilities;	//!< A handle to the probabilities of taking each branch.
+	mutable Core::AliasTable::Handle mAliasTable;	//!< A handle to the sampler of branches (built once for direct value, cached for parameter value).
 };
 } // end of Control namespace
 } // end of Plugins namespace
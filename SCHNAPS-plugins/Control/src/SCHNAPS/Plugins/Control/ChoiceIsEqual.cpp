@@ -77,6 +77,12 @@ ChoiceIsEqual::ChoiceIsEqual(const ChoiceIsEqual& inOriginal) :
 			}
 			break;
 	}
+	if (mChoices_Ref[0] == '$') {
+		// parameter choices may be updated in place, only the map follows them
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mChoiceMap);
+	}
 }
 
 /*!
@@ -123,6 +129,12 @@ ChoiceIsEqual& ChoiceIsEqual::operator=(const ChoiceIsEqual& inOriginal) {
 			}
 			break;
 	}
+	if (mChoices_Ref[0] == '$') {
+		// parameter choices may be updated in place, only the map follows them
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mChoiceMap);
+	}
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Control::ChoiceIsEqual& SCHNAPS::Plugins::Control::ChoiceIsEqual::operator=(const SCHNAPS::Plugins::Control::ChoiceIsEqual&)");
 }
@@ -233,6 +245,14 @@ void ChoiceIsEqual::readWithSystem(PACC::XML::ConstIterator inIter, Core::System
 		throw schnaps_IOExceptionNodeM(*inIter, "at least one choice is expected!");
 	}
 
+	// compile direct choices into a jump table if they are small integral values
+	// (parameter choices may be updated in place, only the map follows them)
+	if (mChoices_Ref[0] == '$') {
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mChoiceMap);
+	}
+
 	setNumberArguments(mChoiceMap.size());
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Control::ChoiceIsEqual::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
@@ -285,6 +305,13 @@ Core::AnyType::Handle ChoiceIsEqual::execute(unsigned int inIndex, Core::Executi
 			break;
 	}
 	
+	// integral choices, unboxed value
+	unsigned int lIndex;
+	bool lFound = false;
+	if (mJumpTable.isCompiled() && mJumpTable.find(*lValue, lIndex, lFound) && lFound) {
+		return getArgument(inIndex, lIndex, ioContext);
+	}
+	
 	lIterChoice = mChoiceMap.find(lValue);
 	if (lIterChoice == mChoiceMap.end()) {
 		std::stringstream lOSS;
@@ -22,6 +22,7 @@
 #define SCHNAPS_Plugins_Control_ChoiceIsEqual_hpp
 
 #include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Control/JumpTable.hpp"
 
 #include "PACC/XML.hpp"
 
@@ -83,6 +84,7 @@ private:
 	Core::Atom::Handle mValue;	//!< A handle to the value to switch on.
 	std::string mChoices_Ref;	//!< Reference to choice values.
 	ChoiceMap mChoiceMap;		//!< Map of values to children index associated.
+	JumpTable mJumpTable;		//!< Table of integral values to children index associated (compiled from direct values if possible).
 };
 } // end of Control namespace
 } // end of Plugins namespace
@@ -26,6 +26,7 @@
 #include "SCHNAPS/Plugins/Control/ChoiceIsBetween.hpp"
 #include "SCHNAPS/Plugins/Control/ChoiceIsEqual.hpp"
 #include "SCHNAPS/Plugins/Control/IfThenElse.hpp"
+#include "SCHNAPS/Plugins/Control/JumpTable.hpp"
 #include "SCHNAPS/Plugins/Control/Nothing.hpp"
 #include "SCHNAPS/Plugins/Control/Parallel.hpp"
 #include "SCHNAPS/Plugins/Control/ProcessCall.hpp"
@@ -0,0 +1,124 @@
+/*
+ * JumpTable.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Control/Control.hpp"
+
+#include <algorithm>
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Control;
+
+/*!
+ * \brief Default constructor (table not compiled).
+ */
+JumpTable::JumpTable() :
+	mType(eNONE),
+	mMinimum(0)
+{}
+
+/*!
+ * \brief Clear the table (not compiled).
+ */
+void JumpTable::clear() {
+	schnaps_StackTraceBeginM();
+	mType = eNONE;
+	mIndexes.clear();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Control::JumpTable::clear()");
+}
+
+/*!
+ * \brief  Compile table from a map of keys, if keys allow it.
+ * \param  inKeys A const reference to the map of keys to associated indexes.
+ * \return True if the table is compiled, false if keys are not all of the same integral type or too sparse.
+ */
+bool JumpTable::compile(const KeyMap& inKeys) {
+	schnaps_StackTraceBeginM();
+	mType = eNONE;
+	mIndexes.clear();
+	if (inKeys.empty()) {
+		return false;
+	}
+	
+	// all keys must be of the same integral type
+	KeyType lType = getKeyType(*inKeys.begin()->first);
+	if (lType == eNONE) {
+		return false;
+	}
+	for (KeyMap::const_iterator lIt = inKeys.begin(); lIt != inKeys.end(); lIt++) {
+		if (getKeyType(*lIt->first) != lType) {
+			return false;
+		}
+	}
+	
+	// unbox keys and check range
+	mType = lType;
+	std::vector<std::pair<long, unsigned int> > lKeys;
+	long lKey;
+	for (KeyMap::const_iterator lIt = inKeys.begin(); lIt != inKeys.end(); lIt++) {
+		unbox(*lIt->first, lKey);
+		lKeys.push_back(std::pair<long, unsigned int>(lKey, lIt->second));
+	}
+	long lMinimum = lKeys[0].first;
+	long lMaximum = lKeys[0].first;
+	for (unsigned int i = 1; i < lKeys.size(); i++) {
+		lMinimum = std::min(lMinimum, lKeys[i].first);
+		lMaximum = std::max(lMaximum, lKeys[i].first);
+	}
+	unsigned long lRange = static_cast<unsigned long>(lMaximum) - static_cast<unsigned long>(lMinimum);
+	if (lRange >= SCHNAPS_CONTROL_JUMPTABLE_MAXRANGE || lRange >= 4 * lKeys.size() + SCHNAPS_CONTROL_JUMPTABLE_MAXRANGE / 64) {
+		// too sparse
+		mType = eNONE;
+		return false;
+	}
+	
+	// fill table
+	mMinimum = lMinimum;
+	mIndexes.assign(lRange + 1, SCHNAPS_CONTROL_JUMPTABLE_NONE);
+	for (unsigned int i = 0; i < lKeys.size(); i++) {
+		mIndexes[static_cast<unsigned long>(lKeys[i].first) - static_cast<unsigned long>(mMinimum)] = lKeys[i].second;
+	}
+	return true;
+	schnaps_StackTraceEndM("bool SCHNAPS::Plugins::Control::JumpTable::compile(const SCHNAPS::Plugins::Control::JumpTable::KeyMap&)");
+}
+
+/*!
+ * \brief  Return the type of a key.
+ * \param  inKey A const reference to the key.
+ * \return The type of key (eNONE if not integral).
+ */
+JumpTable::KeyType JumpTable::getKeyType(const Core::Atom& inKey) {
+	schnaps_StackTraceBeginM();
+	if (dynamic_cast<const Core::Bool*>(&inKey) != NULL) {
+		return eBOOL;
+	} else if (dynamic_cast<const Core::Char*>(&inKey) != NULL) {
+		return eCHAR;
+	} else if (dynamic_cast<const Core::Int*>(&inKey) != NULL) {
+		return eINT;
+	} else if (dynamic_cast<const Core::UInt*>(&inKey) != NULL) {
+		return eUINT;
+	} else if (dynamic_cast<const Core::Long*>(&inKey) != NULL) {
+		return eLONG;
+	} else if (dynamic_cast<const Core::ULong*>(&inKey) != NULL) {
+		return eULONG;
+	}
+	return eNONE;
+	schnaps_StackTraceEndM("SCHNAPS::Plugins::Control::JumpTable::KeyType SCHNAPS::Plugins::Control::JumpTable::getKeyType(const SCHNAPS::Core::Atom&)");
+}
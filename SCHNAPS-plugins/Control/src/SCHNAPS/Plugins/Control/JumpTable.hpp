@@ -0,0 +1,167 @@
+/*
+ * JumpTable.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Control_JumpTable_hpp
+#define SCHNAPS_Plugins_Control_JumpTable_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+
+#include <climits>
+#include <map>
+#include <vector>
+
+// index of missing keys in table
+#define SCHNAPS_CONTROL_JUMPTABLE_NONE UINT_MAX
+// maximal range of keys in table
+#define SCHNAPS_CONTROL_JUMPTABLE_MAXRANGE 65536
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Control {
+
+/*!
+ *  \class JumpTable SCHNAPS/Plugins/Control/JumpTable.hpp "SCHNAPS/Plugins/Control/JumpTable.hpp"
+ *  \brief Dense table of the indexes associated to integral keys (bools, chars and integers).
+ *
+ *  The table is compiled once from a map of keys, if all keys are of the same integral type and
+ *  their range is small enough. A key is then found by unboxing it and indexing the table, instead
+ *  of comparing it to keys through virtual calls.
+ */
+class JumpTable: public Core::Object {
+public:
+	//! JumpTable allocator type.
+	typedef Core::AllocatorT<JumpTable, Core::Object::Alloc> Alloc;
+	//! JumpTable handle type.
+	typedef Core::PointerT<JumpTable, Core::Object::Handle> Handle;
+	//! JumpTable bag type.
+	typedef Core::ContainerT<JumpTable, Core::Object::Bag> Bag;
+	
+	//! Map of keys to associated indexes.
+	typedef std::map<Core::Atom::Handle, unsigned int, Core::IsLessPointerPredicate> KeyMap;
+	
+	//! The integral types of keys.
+	enum KeyType {eNONE, eBOOL, eCHAR, eINT, eUINT, eLONG, eULONG};
+
+	JumpTable();
+	virtual ~JumpTable() {}
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Control_JumpTable");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Control::JumpTable::getName() const");
+	}
+	
+	//! Compile table from a map of keys, if keys allow it.
+	bool compile(const KeyMap& inKeys);
+	//! Clear the table (not compiled).
+	void clear();
+	
+	/*!
+	 * \brief  Return true if the table is compiled.
+	 * \return True if the table is compiled.
+	 */
+	bool isCompiled() const {
+		return mType != eNONE;
+	}
+	
+	/*!
+	 * \brief  Find the index associated to a key in compiled table.
+	 * \param  inKey A const reference to the key.
+	 * \param  outIndex A reference to the index associated to key (set only if key is found).
+	 * \param  outFound A reference to a flag set to true if key is in table.
+	 * \return False if the key is not of the type of table (not searched), true otherwise.
+	 */
+	bool find(const Core::Atom& inKey, unsigned int& outIndex, bool& outFound) const {
+		schnaps_StackTraceBeginM();
+		long lKey;
+		if (unbox(inKey, lKey) == false) {
+			return false;
+		}
+		// unsigned difference rejects keys under minimum
+		unsigned long lOffset = static_cast<unsigned long>(lKey) - static_cast<unsigned long>(mMinimum);
+		outFound = lOffset < mIndexes.size() && mIndexes[lOffset] != SCHNAPS_CONTROL_JUMPTABLE_NONE;
+		if (outFound) {
+			outIndex = mIndexes[lOffset];
+		}
+		return true;
+		schnaps_StackTraceEndM("bool SCHNAPS::Plugins::Control::JumpTable::find(const SCHNAPS::Core::Atom&, unsigned int&, bool&) const");
+	}
+
+private:
+	//! Return the type of a key (eNONE if not integral).
+	static KeyType getKeyType(const Core::Atom& inKey);
+	
+	/*!
+	 * \brief  Unbox a key of the type of table.
+	 * \param  inKey A const reference to the key.
+	 * \param  outKey A reference to the unboxed key.
+	 * \return False if the key is not of the type of table.
+	 */
+	bool unbox(const Core::Atom& inKey, long& outKey) const {
+		switch (mType) {
+			case eBOOL: {
+				const Core::Bool* lKey = dynamic_cast<const Core::Bool*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = lKey->getValue() ? 1 : 0;
+				return true; }
+			case eCHAR: {
+				const Core::Char* lKey = dynamic_cast<const Core::Char*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = lKey->getValue();
+				return true; }
+			case eINT: {
+				const Core::Int* lKey = dynamic_cast<const Core::Int*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = lKey->getValue();
+				return true; }
+			case eUINT: {
+				const Core::UInt* lKey = dynamic_cast<const Core::UInt*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = lKey->getValue();
+				return true; }
+			case eLONG: {
+				const Core::Long* lKey = dynamic_cast<const Core::Long*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = lKey->getValue();
+				return true; }
+			case eULONG: {
+				const Core::ULong* lKey = dynamic_cast<const Core::ULong*>(&inKey);
+				if (lKey == NULL) return false;
+				outKey = static_cast<long>(lKey->getValue());
+				return true; }
+			default: // eNONE
+				return false;
+		}
+	}
+
+	KeyType mType;						//!< The type of keys (eNONE if table is not compiled).
+	long mMinimum;						//!< The smallest key.
+	std::vector<unsigned int> mIndexes;	//!< The indexes associated to keys, from smallest key.
+};
+} // end of Control namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Control_JumpTable_hpp */
@@ -96,21 +96,17 @@ void ProcessCall::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) c
 Core::AnyType::Handle ProcessCall::execute(unsigned int inIndex, Core::ExecutionContext& ioContext) const {
 	schnaps_StackTraceBeginM();
 	Core::AnyType::Handle lResult;
-	Core::PrimitiveTree::Handle lCurrentPrimitiveTree;
+	const Core::PrimitiveTree* lCurrentPrimitiveTree;
 	Simulation::SimulationContext& lContext = Core::castObjectT<Simulation::SimulationContext&>(ioContext);
 
-	// save current primitive tree and local variables
-	lCurrentPrimitiveTree = lContext.getPrimitiveTreeHandle();
-	Simulation::SimulationContext::LocalVariablesMap lCurrentLocalVariables = lContext.getLocalVariables();
+	// save current primitive tree (local variables of called process are pushed in their own frame)
+	lCurrentPrimitiveTree = lContext.getPrimitiveTreePointer();
 
 	// execute process called
 	lResult = lContext.getProcessHandle(mLabel)->execute(ioContext);
 
-	// restore current primitive tree and local variables
+	// restore current primitive tree
 	lContext.setPrimitiveTree(lCurrentPrimitiveTree);
-	for (Simulation::SimulationContext::LocalVariablesMap::const_iterator lIt = lCurrentLocalVariables.begin(); lIt != lCurrentLocalVariables.end(); lIt++) {
-		lContext.insertLocalVariable(lIt->first, lIt->second);
-	}
 
 	return lResult;
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Plugins::Control::ProcessCall::execute(unsigned int, SCHNAPS::Core::ExecutionContext&)");
@@ -52,6 +52,12 @@ Switch::Switch(const Switch& inOriginal) :
 			mSwitchMap.insert(std::pair<Core::Atom::Handle, unsigned int>(Core::castHandleT<Core::Atom>(lIt->first->clone()), lIt->second));
 		}
 	}
+	if (mKeys_Ref[0] == '$') {
+		// parameter keys may be updated in place, only the map follows them
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mSwitchMap);
+	}
 }
 
 /*!
@@ -74,6 +80,12 @@ Switch& Switch::operator=(const Switch& inOriginal) {
 			mSwitchMap.insert(std::pair<Core::Atom::Handle, unsigned int>(Core::castHandleT<Core::Atom>(lIt->first->clone()), lIt->second));
 		}
 	}
+	if (mKeys_Ref[0] == '$') {
+		// parameter keys may be updated in place, only the map follows them
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mSwitchMap);
+	}
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Core::Switch& SCHNAPS::Plugins::Control::Switch::operator=(const SCHNAPS::Core::Switch&)");
 }
@@ -149,6 +161,14 @@ void Switch::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSys
 		}
 	}
 
+	// compile direct keys into a jump table if they are small integral values
+	// (parameter keys may be updated in place, only the map follows them)
+	if (mKeys_Ref[0] == '$') {
+		mJumpTable.clear();
+	} else {
+		mJumpTable.compile(mSwitchMap);
+	}
+
 	setNumberArguments(mSwitchMap.size() + 2); // + 1 for the value switched on, +1 for default case
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Control::Switch::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
@@ -180,6 +200,13 @@ Core::AnyType::Handle Switch::execute(unsigned int inIndex, Core::ExecutionConte
 	
 	Core::Atom::Handle lArg = Core::castHandleT<Core::Atom>(getArgument(inIndex, 0, ioContext));
 	
+	// integral keys, unboxed value
+	unsigned int lIndex;
+	bool lFound;
+	if (mJumpTable.isCompiled() && mJumpTable.find(*lArg, lIndex, lFound)) {
+		return getArgument(inIndex, lFound ? lIndex+2 : 1, ioContext);
+	}
+	
 	// direct value or parameter value
 	SwitchMap::const_iterator lIt = mSwitchMap.find(lArg);
 	if (lIt != mSwitchMap.end()) {
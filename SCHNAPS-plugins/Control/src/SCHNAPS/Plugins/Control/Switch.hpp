@@ -22,6 +22,7 @@
 #define SCHNAPS_Plugins_Control_Switch_hpp
 
 #include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Control/JumpTable.hpp"
 
 #include "PACC/XML.hpp"
 
@@ -80,6 +81,7 @@ public:
 private:
 	std::string mKeys_Ref;	//!< Reference to switch keys.
 	SwitchMap mSwitchMap;	//!< Map of keys to associated argument index.
+	JumpTable mJumpTable;	//!< Table of integral keys to associated argument index (compiled from direct values if possible).
 };
 } // end of Control namespace
 } // end of Plugins namespace
@@ -37,7 +37,9 @@ RouletteDynamic::RouletteDynamic() :
  */
 RouletteDynamic::RouletteDynamic(const RouletteDynamic& inOriginal) :
 	Primitive(inOriginal.getNumberArguments())
-{}
+{
+	resize(inOriginal.mAliasTables.size());
+}
 
 /*!
  * \brief  Copy operator.
@@ -46,10 +48,27 @@ RouletteDynamic::RouletteDynamic(const RouletteDynamic& inOriginal) :
 RouletteDynamic& RouletteDynamic::operator=(const RouletteDynamic& inOriginal) {
 	schnaps_StackTraceBeginM();
 	this->setNumberArguments(inOriginal.getNumberArguments());
+	resize(inOriginal.mAliasTables.size());
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Data::RouletteDynamic& SCHNAPS::Plugins::Data::RouletteDynamic::operator=(const SCHNAPS::Plugins::Data::RouletteDynamic&)");
 }
 
+/*!
+ * \brief Read object from XML using system.
+ * \param inIter XML iterator of input document.
+ * \param ioSystem A reference to the system.
+ *
+ * One sampler is kept per simulation or generation thread.
+ */
+void RouletteDynamic::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSystem) {
+	schnaps_StackTraceBeginM();
+	Primitive::readWithSystem(inIter, ioSystem);
+	unsigned int lThreadsSimulator = Core::castObjectT<const Core::UInt&>(ioSystem.getParameters().getParameter("threads.simulator")).getValue();
+	unsigned int lThreadsGenerator = Core::castObjectT<const Core::UInt&>(ioSystem.getParameters().getParameter("threads.generator")).getValue();
+	resize(std::max(lThreadsSimulator, lThreadsGenerator));
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Data::RouletteDynamic::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
+}
+
 /*!
  * \brief  Execute the primitive.
  * \param  inIndex Index of the current primitive.
@@ -60,6 +79,35 @@ Core::AnyType::Handle RouletteDynamic::execute(unsigned int inIndex, Core::Execu
 	schnaps_StackTraceBeginM();
 	double lTotal = 0;
 	Core::Double::Handle lArg;
+	
+	// invariant children (and a sampler for thread, which may be missing if threads were added since read)
+	unsigned int lThreadNb = ioContext.getThreadNb();
+	bool lInvariant = lThreadNb < mAliasTables.size();
+	unsigned int lArgIndex;
+	for (unsigned int i = 0; lInvariant && i < getNumberArguments(); i++) {
+		lArgIndex = getArgumentIndex(inIndex, i, ioContext);
+		lInvariant = ioContext.getPrimitiveTree().isInvariant(lArgIndex, ioContext);
+	}
+	
+	if (lInvariant) {
+		// weights are the same for every individual, sampler is rebuilt only if they changed
+		std::vector<double>& lWeights = mWeights[lThreadNb];
+		lWeights.clear();
+		for (unsigned int i = 0; i < getNumberArguments(); i++) {
+			lArg = Core::castHandleT<Core::Double>(getArgument(inIndex, i, ioContext));
+			lWeights.push_back(lArg->getValue());
+			lTotal += lArg->getValue();
+		}
+		if (lTotal < 1) {
+			// insert default (last branch) value
+			lWeights.push_back(1-lTotal);
+		}
+		if (lWeights != mAliasTables[lThreadNb]->getWeights()) {
+			mAliasTables[lThreadNb]->build(lWeights);
+		}
+		return new Core::UInt(mAliasTables[lThreadNb]->select(ioContext.getRandomizer()) + 1);
+	}
+	
 	Core::RouletteT<unsigned int> lRoulette;
 
 	// insert branches values
@@ -105,3 +153,19 @@ const std::string& RouletteDynamic::getReturnType(unsigned int inIndex, Core::Ex
 	return lType;
 	schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Data::RouletteDynamic::getReturnType(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
+
+/*!
+ * \brief Resize the samplers of threads.
+ * \param inThreads The number of threads.
+ */
+void RouletteDynamic::resize(unsigned int inThreads) {
+	schnaps_StackTraceBeginM();
+	mAliasTables.resize(inThreads);
+	for (unsigned int i = 0; i < mAliasTables.size(); i++) {
+		if (mAliasTables[i] == NULL) {
+			mAliasTables[i] = new Core::AliasTable();
+		}
+	}
+	mWeights.resize(inThreads);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Data::RouletteDynamic::resize(unsigned int)");
+}
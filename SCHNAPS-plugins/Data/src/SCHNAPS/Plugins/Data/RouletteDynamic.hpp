@@ -25,6 +25,8 @@
 
 #include "PACC/XML.hpp"
 
+#include <vector>
+
 namespace SCHNAPS {
 namespace Plugins {
 namespace Data {
@@ -32,6 +34,10 @@ namespace Data {
 /*!
  *  \class RouletteDynamic SCHNAPS/Plugins/Data/RouletteDynamic.hpp "SCHNAPS/Plugins/Data/RouletteDynamic.hpp"
  *  \brief Return an unsigned int from a roulette with dynamic weights.
+ *
+ *  When all children are invariant, their weights are the same for every individual, so each thread
+ *  keeps an alias table that is rebuilt only when the weights change. Otherwise, a roulette is built
+ *  on each call.
  */
 class RouletteDynamic: public Core::Primitive {
 public:
@@ -60,12 +66,22 @@ public:
 		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Data::RouletteDynamic::getName() const");
 	}
 
+	//! Read object from XML using system.
+	virtual void readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSystem);
+
 	//! Execute the primitive.
 	virtual Core::AnyType::Handle execute(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
 	//! Return the nth argument requested return type.
 	virtual const std::string& getArgType(unsigned int inIndex, unsigned int inN, Core::ExecutionContext& ioContext) const;
 	//! Return the primitive return type.
 	virtual const std::string& getReturnType(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
+
+private:
+	//! Resize the samplers of threads.
+	void resize(unsigned int inThreads);
+
+	mutable Core::AliasTable::Bag mAliasTables;		//!< Samplers per thread number (used when all children are invariant).
+	mutable std::vector<std::vector<double> > mWeights;	//!< Buffers of weights per thread number.
 };
 } // end of Data namespace
 } // end of Plugins namespace
@@ -225,3 +225,15 @@ const std::string& Value::getReturnType(unsigned int inIndex, Core::ExecutionCon
 	}
 	schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Data::Value::getReturnType(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
+
+/*!
+ * \brief  Return true if the primitive always returns the same value, whatever the individual.
+ * \param  inIndex Index of the current primitive.
+ * \param  ioContext A reference to the execution context.
+ * \return True if the value does not refer to an individual variable, false if not.
+ */
+bool Value::isInvariant(unsigned int inIndex, Core::ExecutionContext& ioContext) const {
+	schnaps_StackTraceBeginM();
+	return mValue_Ref[0] != '@';
+	schnaps_StackTraceEndM("bool SCHNAPS::Plugins::Data::Value::isInvariant(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
+}
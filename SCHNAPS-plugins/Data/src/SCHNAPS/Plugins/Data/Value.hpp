@@ -65,6 +65,8 @@ public:
 	virtual Core::AnyType::Handle execute(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
 	//! Return the primitive return type.
 	virtual const std::string& getReturnType(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
+	//! Return true if the primitive always returns the same value, whatever the individual.
+	virtual bool isInvariant(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
 
 private:
 	std::string mValue_Ref; 		//!< Reference to the value.
@@ -0,0 +1,282 @@
+/*
+ * ActionTable.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Learning/Learning.hpp"
+
+#include <cmath>
+#include <map>
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Learning;
+
+/*!
+ * \brief Remove all states from table.
+ */
+void ActionTable::clear() {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < SCHNAPS_LEARNING_ACTIONTABLE_SHARDS; i++) {
+		mShards[i].mMutex.lock();
+		mShards[i].mSlots.clear();
+		mShards[i].mHashes.clear();
+		mShards[i].mStates.clear();
+		mShards[i].mActions.clear();
+		mShards[i].mUpdates.clear();
+		mShards[i].mMutex.unlock();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::clear()");
+}
+
+/*!
+ * \brief  Return the ID of a specific state, adding the state if necessary.
+ * \param  inState A const reference to the specific state.
+ * \param  inOptions A const reference to the labels of all possible actions (used if state is added).
+ * \return The ID of state.
+ */
+unsigned int ActionTable::getStateID(const std::string& inState, const std::vector<std::string>& inOptions) {
+	schnaps_StackTraceBeginM();
+	unsigned int lHash = mHash(inState);
+	unsigned int lShardIndex = lHash & (SCHNAPS_LEARNING_ACTIONTABLE_SHARDS - 1);
+	Shard& lShard = mShards[lShardIndex];
+	
+	lShard.mMutex.lock();
+	unsigned int lIndex = findState(lShard, inState, lHash, inOptions);
+	lShard.mMutex.unlock();
+	return (lIndex << SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS) | lShardIndex;
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::ActionTable::getStateID(const std::string&, const std::vector<std::string>&)");
+}
+
+/*!
+ * \brief  Return a const reference to the state of a specific ID.
+ * \param  inStateID The ID of state.
+ * \return A const reference to the state.
+ */
+const std::string& ActionTable::getState(unsigned int inStateID) const {
+	schnaps_StackTraceBeginM();
+	const Shard& lShard = mShards[inStateID & (SCHNAPS_LEARNING_ACTIONTABLE_SHARDS - 1)];
+	lShard.mMutex.lock();
+	const std::string& lState = lShard.mStates[inStateID >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS];
+	lShard.mMutex.unlock();
+	return lState;
+	schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Learning::ActionTable::getState(unsigned int) const");
+}
+
+/*!
+ * \brief  Return a reference to all actions in the state of a specific ID.
+ * \param  inStateID The ID of state.
+ * \return A reference to all actions in the state.
+ */
+std::vector<Action>& ActionTable::getActions(unsigned int inStateID) {
+	schnaps_StackTraceBeginM();
+	Shard& lShard = mShards[inStateID & (SCHNAPS_LEARNING_ACTIONTABLE_SHARDS - 1)];
+	lShard.mMutex.lock();
+	std::vector<Action>& lActions = lShard.mActions[inStateID >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS];
+	lShard.mMutex.unlock();
+	return lActions;
+	schnaps_StackTraceEndM("std::vector<SCHNAPS::Plugins::Learning::Action>& SCHNAPS::Plugins::Learning::ActionTable::getActions(unsigned int)");
+}
+
+/*!
+ * \brief Add a reward to the statistics of an action in the state of a specific ID.
+ * \param inStateID The ID of state.
+ * \param inActionID The ID of action taken.
+ * \param inReward The reward obtained.
+ */
+void ActionTable::update(unsigned int inStateID, unsigned int inActionID, double inReward) {
+	schnaps_StackTraceBeginM();
+	Shard& lShard = mShards[inStateID & (SCHNAPS_LEARNING_ACTIONTABLE_SHARDS - 1)];
+	// the shard lock keeps the count and sums of action consistent with each other, which separate
+	// atomic operations would not (and __sync builtins have no floating-point addition)
+	lShard.mMutex.lock();
+	Action& lAction = lShard.mActions[inStateID >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS][inActionID];
+	lAction.setTried(true);
+	lAction.setUpdatedTimes(lAction.getUpdatedTimes() + 1);
+	lAction.setReward(lAction.getReward() + inReward);
+	lAction.setReward2(lAction.getReward2() + pow(inReward, 2));
+	
+	Update& lUpdate = lShard.mUpdates[inStateID >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS][inActionID];
+	lUpdate.mUpdatedTimes++;
+	lUpdate.mReward += inReward;
+	lUpdate.mReward2 += pow(inReward, 2);
+	lShard.mMutex.unlock();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::update(unsigned int, unsigned int, double)");
+}
+
+/*!
+ * \brief Write content of table to XML, in state order.
+ * \param ioStreamer XML streamer to output document.
+ * \param inIndent Wether to indent or not.
+ */
+void ActionTable::writeStates(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
+	schnaps_StackTraceBeginM();
+	// merge shards in state order
+	std::map<std::string, const std::vector<Action>*> lStates;
+	for (unsigned int i = 0; i < SCHNAPS_LEARNING_ACTIONTABLE_SHARDS; i++) {
+		for (unsigned int j = 0; j < mShards[i].mStates.size(); j++) {
+			lStates.insert(std::pair<std::string, const std::vector<Action>*>(mShards[i].mStates[j], &mShards[i].mActions[j]));
+		}
+	}
+	
+	for (std::map<std::string, const std::vector<Action>*>::const_iterator lIt = lStates.begin(); lIt != lStates.end(); lIt++) {
+		ioStreamer.openTag("State");
+		ioStreamer.insertAttribute("label", lIt->first);
+		for (unsigned int i = 0; i < lIt->second->size(); i++) {
+			(*lIt->second)[i].write(ioStreamer, inIndent);
+		}
+		ioStreamer.closeTag();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::writeStates(PACC::XML::Streamer&, bool) const");
+}
+
+/*!
+ * \brief Replace content of table by a copy of another table.
+ * \param inOriginal A const reference to the original table.
+ *
+ * Tables must not be used by other threads while copied.
+ */
+void ActionTable::assign(const ActionTable& inOriginal) {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < SCHNAPS_LEARNING_ACTIONTABLE_SHARDS; i++) {
+		mShards[i].mSlots = inOriginal.mShards[i].mSlots;
+		mShards[i].mHashes = inOriginal.mShards[i].mHashes;
+		mShards[i].mStates = inOriginal.mShards[i].mStates;
+		mShards[i].mActions = inOriginal.mShards[i].mActions;
+		mShards[i].mUpdates.assign(inOriginal.mShards[i].mUpdates.size(), std::vector<Update>());
+		for (unsigned int j = 0; j < mShards[i].mUpdates.size(); j++) {
+			mShards[i].mUpdates[j].resize(mShards[i].mActions[j].size());
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::assign(const SCHNAPS::Plugins::Learning::ActionTable&)");
+}
+
+/*!
+ * \brief Add the updates of another table since its last merge.
+ * \param inTable A const reference to the other table.
+ *
+ * Tables must not be used by other threads while merged. Updates are added in the order of states in
+ * the other table, so that merging the same tables in the same order always gives the same sums.
+ */
+void ActionTable::mergeUpdates(const ActionTable& inTable) {
+	schnaps_StackTraceBeginM();
+	std::vector<std::string> lOptions;
+	unsigned int lIndex;
+	for (unsigned int i = 0; i < SCHNAPS_LEARNING_ACTIONTABLE_SHARDS; i++) {
+		const Shard& lShardIn = inTable.mShards[i];
+		// same hash function, so same shard
+		Shard& lShard = mShards[i];
+		for (unsigned int j = 0; j < lShardIn.mStates.size(); j++) {
+			lOptions.clear();
+			for (unsigned int k = 0; k < lShardIn.mActions[j].size(); k++) {
+				lOptions.push_back(lShardIn.mActions[j][k].getLabel());
+			}
+			lIndex = findState(lShard, lShardIn.mStates[j], lShardIn.mHashes[j], lOptions);
+			
+			for (unsigned int k = 0; k < lShardIn.mUpdates[j].size(); k++) {
+				const Update& lUpdate = lShardIn.mUpdates[j][k];
+				if (lUpdate.mUpdatedTimes > 0) {
+					Action& lAction = lShard.mActions[lIndex][k];
+					lAction.setTried(true);
+					lAction.setUpdatedTimes(lAction.getUpdatedTimes() + lUpdate.mUpdatedTimes);
+					lAction.setReward(lAction.getReward() + lUpdate.mReward);
+					lAction.setReward2(lAction.getReward2() + lUpdate.mReward2);
+				}
+			}
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::mergeUpdates(const SCHNAPS::Plugins::Learning::ActionTable&)");
+}
+
+/*!
+ * \brief Forget updates since last merge.
+ */
+void ActionTable::clearUpdates() {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < SCHNAPS_LEARNING_ACTIONTABLE_SHARDS; i++) {
+		for (unsigned int j = 0; j < mShards[i].mUpdates.size(); j++) {
+			mShards[i].mUpdates[j].assign(mShards[i].mUpdates[j].size(), Update());
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::clearUpdates()");
+}
+
+/*!
+ * \brief  Return the index of a state in a locked shard, adding the state if necessary.
+ * \param  ioShard A reference to the locked shard.
+ * \param  inState A const reference to the specific state.
+ * \param  inHash The hash of state.
+ * \param  inOptions A const reference to the labels of all possible actions (used if state is added).
+ * \return The index of state in shard.
+ */
+unsigned int ActionTable::findState(Shard& ioShard, const std::string& inState, unsigned int inHash, const std::vector<std::string>& inOptions) {
+	schnaps_StackTraceBeginM();
+	if (ioShard.mSlots.empty()) {
+		ioShard.mSlots.assign(16, 0);
+	}
+	
+	// linear probing
+	unsigned int lMask = ioShard.mSlots.size() - 1;
+	unsigned int lSlot = (inHash >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS) & lMask;
+	unsigned int lIndex;
+	while (ioShard.mSlots[lSlot] != 0) {
+		lIndex = ioShard.mSlots[lSlot] - 1;
+		if (ioShard.mHashes[lIndex] == inHash && ioShard.mStates[lIndex] == inState) {
+			return lIndex;
+		}
+		lSlot = (lSlot + 1) & lMask;
+	}
+	
+	// unknown state, add it and all possible actions (options)
+	lIndex = ioShard.mStates.size();
+	ioShard.mSlots[lSlot] = lIndex + 1;
+	ioShard.mHashes.push_back(inHash);
+	ioShard.mStates.push_back(inState);
+	ioShard.mActions.push_back(std::vector<Action>());
+	ioShard.mActions.back().reserve(inOptions.size());
+	for (unsigned int i = 0; i < inOptions.size(); i++) {
+		ioShard.mActions.back().push_back(Action(inOptions[i]));
+	}
+	ioShard.mUpdates.push_back(std::vector<Update>(inOptions.size()));
+	
+	// keep load factor under one half
+	if (2 * ioShard.mStates.size() > ioShard.mSlots.size()) {
+		grow(ioShard);
+	}
+	return lIndex;
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::ActionTable::findState(SCHNAPS::Plugins::Learning::ActionTable::Shard&, const std::string&, unsigned int, const std::vector<std::string>&)");
+}
+
+/*!
+ * \brief Double the number of slots of a locked shard.
+ * \param ioShard A reference to the locked shard.
+ */
+void ActionTable::grow(Shard& ioShard) {
+	schnaps_StackTraceBeginM();
+	ioShard.mSlots.assign(2 * ioShard.mSlots.size(), 0);
+	unsigned int lMask = ioShard.mSlots.size() - 1;
+	unsigned int lSlot;
+	for (unsigned int i = 0; i < ioShard.mHashes.size(); i++) {
+		lSlot = (ioShard.mHashes[i] >> SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS) & lMask;
+		while (ioShard.mSlots[lSlot] != 0) {
+			lSlot = (lSlot + 1) & lMask;
+		}
+		ioShard.mSlots[lSlot] = i + 1;
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ActionTable::grow(SCHNAPS::Plugins::Learning::ActionTable::Shard&)");
+}
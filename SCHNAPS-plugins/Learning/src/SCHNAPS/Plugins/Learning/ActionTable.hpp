@@ -0,0 +1,146 @@
+/*
+ * ActionTable.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Learning_ActionTable_hpp
+#define SCHNAPS_Plugins_Learning_ActionTable_hpp
+
+#include "SCHNAPS/Plugins/Learning/Action.hpp"
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "PACC/PACC.hpp"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+// number of independently locked parts of an action table (power of 2)
+#define SCHNAPS_LEARNING_ACTIONTABLE_SHARDS 64
+// number of bits of state IDs used for the shard index
+#define SCHNAPS_LEARNING_ACTIONTABLE_SHARDBITS 6
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Learning {
+
+/*!
+ *  \class ActionTable SCHNAPS/Plugins/Learning/ActionTable.hpp "SCHNAPS/Plugins/Learning/ActionTable.hpp"
+ *  \brief Statistics of actions per state of a choice, shared by the decision makers of all threads.
+ *
+ *  Each state is encoded once as an integer ID; afterwards, statistics are reached by ID without any
+ *  string comparison. States are spread over independently locked shards according to their hash;
+ *  each shard maps states to IDs with a flat open-addressing table (linear probing), so that threads
+ *  only contend when they work on states of the same shard. The low bits of a state ID give its shard
+ *  and the high bits its index in the shard. Statistics of an action are stored at a fixed address once
+ *  its state has been added.
+ *
+ *  Updates since the last merge are also kept apart, so that tables trained independently (e.g. by
+ *  concurrent learning episodes) can be merged.
+ */
+class ActionTable: public Core::Object {
+public:
+	//! ActionTable allocator type.
+	typedef Core::AllocatorT<ActionTable, Core::Object::Alloc> Alloc;
+	//! ActionTable handle type.
+	typedef Core::PointerT<ActionTable, Core::Object::Handle> Handle;
+	//! ActionTable bag type.
+	typedef Core::ContainerT<ActionTable, Core::Object::Bag> Bag;
+
+	ActionTable() {}
+	virtual ~ActionTable() {}
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Learning_ActionTable");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Learning::ActionTable::getName() const");
+	}
+
+	//! Remove all states from table.
+	void clear();
+	//! Return the ID of a specific state, adding the state if necessary.
+	unsigned int getStateID(const std::string& inState, const std::vector<std::string>& inOptions);
+	//! Return a const reference to the state of a specific ID.
+	const std::string& getState(unsigned int inStateID) const;
+	//! Return a reference to all actions in the state of a specific ID.
+	std::vector<Action>& getActions(unsigned int inStateID);
+	//! Add a reward to the statistics of an action in the state of a specific ID.
+	void update(unsigned int inStateID, unsigned int inActionID, double inReward);
+	//! Write content of table to XML, in state order.
+	void writeStates(PACC::XML::Streamer& ioStreamer, bool inIndent) const;
+	
+	//! Replace content of table by a copy of another table.
+	void assign(const ActionTable& inOriginal);
+	//! Add the updates of another table since its last merge.
+	void mergeUpdates(const ActionTable& inTable);
+	//! Forget updates since last merge.
+	void clearUpdates();
+
+private:
+	/*!
+	 * \struct Update SCHNAPS/Plugins/Learning/ActionTable.hpp "SCHNAPS/Plugins/Learning/ActionTable.hpp"
+	 * \brief  Cumulated updates of an action since last merge.
+	 */
+	struct Update {
+		unsigned int mUpdatedTimes;	//!< Number of updates.
+		double mReward;				//!< Sum of rewards.
+		double mReward2;			//!< Sum of squared rewards.
+		
+		Update() :
+			mUpdatedTimes(0),
+			mReward(0),
+			mReward2(0)
+		{}
+	};
+	
+
+	/*!
+	 * \struct Shard SCHNAPS/Plugins/Learning/ActionTable.hpp "SCHNAPS/Plugins/Learning/ActionTable.hpp"
+	 * \brief  Independently locked part of the table.
+	 */
+	struct Shard {
+		std::vector<unsigned int> mSlots;			//!< Open-addressing table of (index in shard + 1), 0 if empty.
+		std::vector<unsigned int> mHashes;			//!< Hash of states, indexed by index in shard.
+		std::deque<std::string> mStates;			//!< States, indexed by index in shard.
+		std::deque<std::vector<Action> > mActions;	//!< Statistics of actions, indexed by index in shard.
+		std::deque<std::vector<Update> > mUpdates;	//!< Updates of actions since last merge, indexed by index in shard.
+		PACC::Threading::Mutex mMutex;				//!< Lock of shard.
+	};
+
+	// shards are not copyable
+	ActionTable(const ActionTable&);
+	ActionTable& operator=(const ActionTable&);
+
+	//! Return the index of a state in a locked shard, adding the state if necessary.
+	static unsigned int findState(Shard& ioShard, const std::string& inState, unsigned int inHash, const std::vector<std::string>& inOptions);
+	//! Double the number of slots of a locked shard.
+	static void grow(Shard& ioShard);
+
+	Shard mShards[SCHNAPS_LEARNING_ACTIONTABLE_SHARDS];	//!< Shards of table.
+	Core::HashString mHash;								//!< Hash function of states.
+};
+} // end of Learning namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Learning_ActionTable_hpp */
@@ -92,7 +92,8 @@ void Choice::Function::writeContent(PACC::XML::Streamer& ioStreamer, bool inInde
  * \brief Default constructor.
  */
 Choice::Choice() :
-	mLabel("")
+	mLabel(""),
+	mActionTable(new ActionTable())
 {}
 
 /*!
@@ -102,7 +103,8 @@ Choice::Choice() :
 Choice::Choice(const Choice& inOriginal) :
 	mLabel(inOriginal.mLabel.c_str()),
 	mFunctionState(inOriginal.mFunctionState),
-	mFunctionReward(inOriginal.mFunctionReward)
+	mFunctionReward(inOriginal.mFunctionReward),
+	mActionTable(inOriginal.mActionTable)
 {}
 
 /*!
@@ -137,6 +139,9 @@ Core::Object::Handle Choice::deepCopy(const Core::System& inSystem) const {
 	}
 	lCopy->mFunctionReward.mExecution = Core::castHandleT<Core::PrimitiveTree>(this->mFunctionReward.mExecution->deepCopy(inSystem));
 	
+	// share statistics of actions (updated by all threads)
+	lCopy->mActionTable = this->mActionTable;
+	
 	return lCopy;
 	schnaps_StackTraceEndM("SCHNAPS::Core::Object::Handle SCHNAPS::Plugins::Learning::Choice::deepCopy(const SCHNAPS::Core::System&) const");
 }
@@ -200,25 +205,26 @@ void Choice::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 }
 
 /*!
- * \brief  Return the state computed using a specific learning context.
+ * \brief  Return the ID of state computed using a specific learning context.
  * \param  A reference to learning context to use for computing state.
- * \return The state computed using a specific learning context.
+ * \return The ID of state computed using a specific learning context.
  */
-std::string Choice::computeState(LearningContext& ioContext) const {
+unsigned int Choice::computeState(LearningContext& ioContext) {
 	schnaps_StackTraceBeginM();
 	Core::AnyType::Handle lVariable;
 	// set local variables
+	ioContext.pushLocalFrame();
 	for (unsigned int i = 0; i < mFunctionState.mLocalVariables.size(); i++) {
 	    lVariable = Core::castHandleT<Core::AnyType>(mFunctionState.mLocalVariables[i].second->clone());
 		ioContext.insertLocalVariable(
 			mFunctionState.mLocalVariables[i].first, lVariable);
 	}
 	
-	std::string lState = Core::castHandleT<Core::String>(mFunctionState.mExecution->interpret(ioContext))->getValue();
-	ioContext.clearLocalVariables();
+	Core::String::Handle lState = Core::castHandleT<Core::String>(mFunctionState.mExecution->interpret(ioContext));
+	ioContext.popLocalFrame();
 	
-	return lState;
-	schnaps_StackTraceEndM("std::string SCHNAPS::Plugins::Learning::Choice::computeState(SCHNAPS::Plugins::Learning::LearningContext&) const");
+	return getStateID(lState->getValue());
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::Choice::computeState(SCHNAPS::Plugins::Learning::LearningContext&)");
 }
 
 /*!
@@ -230,6 +236,7 @@ double Choice::computeReward(LearningContext& ioContext) const {
 	schnaps_StackTraceBeginM();
 	Core::AnyType::Handle lVariable;
 	// set local variables
+	ioContext.pushLocalFrame();
 	for (unsigned int i = 0; i < mFunctionReward.mLocalVariables.size(); i++) {
 	    lVariable = Core::castHandleT<Core::AnyType>(mFunctionReward.mLocalVariables[i].second->clone());
 		ioContext.insertLocalVariable(
@@ -237,12 +244,52 @@ double Choice::computeReward(LearningContext& ioContext) const {
 	}
 	
 	double lReward = Core::castHandleT<Core::Double>(mFunctionReward.mExecution->interpret(ioContext))->getValue();
-	ioContext.clearLocalVariables();
+	ioContext.popLocalFrame();
 	
 	return lReward;
 	schnaps_StackTraceEndM("double SCHNAPS::Plugins::Learning::Choice::computeReward(SCHNAPS::Plugins::Learning::LearningContext&) const");
 }
 
+/*!
+ * \brief Push a frame with the local variables of reward function in a learning context, for computing a batch of rewards.
+ * \param ioContext A reference to the learning context to use for computing rewards.
+ * \param outFrame A reference to the values of local variables (cloned once for the batch).
+ *
+ * The frame must be popped from context (popLocalFrame) once the batch is computed.
+ */
+void Choice::openRewardFrame(LearningContext& ioContext, std::vector<Core::AnyType::Handle>& outFrame) const {
+	schnaps_StackTraceBeginM();
+	outFrame.resize(mFunctionReward.mLocalVariables.size());
+	ioContext.pushLocalFrame();
+	for (unsigned int i = 0; i < mFunctionReward.mLocalVariables.size(); i++) {
+		outFrame[i] = Core::castHandleT<Core::AnyType>(mFunctionReward.mLocalVariables[i].second->clone());
+		ioContext.insertLocalVariable(mFunctionReward.mLocalVariables[i].first, outFrame[i]);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::Choice::openRewardFrame(SCHNAPS::Plugins::Learning::LearningContext&, std::vector<SCHNAPS::Core::AnyType::Handle>&) const");
+}
+
+/*!
+ * \brief  Return the reward computed using a specific learning context where the frame of reward function is pushed.
+ * \param  ioContext A reference to the learning context to use for computing reward.
+ * \param  ioFrame A reference to the values of local variables.
+ * \return The reward computed using a specific learning context.
+ *
+ * Local variables are set in place, so the values of frame are reset to the initial values of
+ * reward function for next reward, by typed copy.
+ */
+double Choice::computeRewardInFrame(LearningContext& ioContext, std::vector<Core::AnyType::Handle>& ioFrame) const {
+	schnaps_StackTraceBeginM();
+	double lReward = Core::castHandleT<Core::Double>(mFunctionReward.mExecution->interpret(ioContext))->getValue();
+	
+	// restore local variables for next reward
+	for (unsigned int i = 0; i < ioFrame.size(); i++) {
+		ioFrame[i]->copyValue(*mFunctionReward.mLocalVariables[i].second);
+	}
+	
+	return lReward;
+	schnaps_StackTraceEndM("double SCHNAPS::Plugins::Learning::Choice::computeRewardInFrame(SCHNAPS::Plugins::Learning::LearningContext&, std::vector<SCHNAPS::Core::AnyType::Handle>&) const");
+}
+
 // private
 
 /*!
@@ -375,7 +422,7 @@ void Choice::readChoiceMap(PACC::XML::ConstIterator inIter, Core::System& ioSyst
 		throw schnaps_IOExceptionNodeM(*inIter, lOSS.str());
 	}
 
-	clear();
+	mActionTable->clear();
 	std::string lState;
 	unsigned int lActionID;
 	for (PACC::XML::ConstIterator lChild_i = inIter->getFirstChild(); lChild_i; lChild_i++) {
@@ -394,7 +441,7 @@ void Choice::readChoiceMap(PACC::XML::ConstIterator inIter, Core::System& ioSyst
 			lState = lChild_i->getAttribute("label");
 			
 			// init all actions for that state
-			getActions(lState);
+			std::vector<Action>& lActions = getActions(getStateID(lState));
 			lActionID = 0;
 			if (lChild_i->getChildCount() != mOptions.size()) {
 				throw schnaps_IOExceptionNodeM(*lChild_i, "expected an action description for each option in choice!");
@@ -402,7 +449,7 @@ void Choice::readChoiceMap(PACC::XML::ConstIterator inIter, Core::System& ioSyst
 			for (PACC::XML::ConstIterator lChild_j = lChild_i->getFirstChild(); lChild_j; lChild_j++) {
 				// read action descriptions for that state
 				if (lChild_j->getType() == PACC::XML::eData) {
-					(*this)[lState][lActionID].readWithSystem(lChild_j, ioSystem);
+					lActions[lActionID].readWithSystem(lChild_j, ioSystem);
 				}
                 lActionID++;
 			}
@@ -462,14 +509,7 @@ void Choice::writeFunctionReward(PACC::XML::Streamer& ioStreamer, bool inIndent)
 void Choice::writeChoiceMap(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
 	schnaps_StackTraceBeginM();
 	ioStreamer.openTag("ChoiceMap");
-	for (Choice::const_iterator lIt = this->begin(); lIt != this->end(); lIt++) {
-		ioStreamer.openTag("State");
-		ioStreamer.insertAttribute("label", lIt->first);
-		for (unsigned int i = 0; i < lIt->second.size(); i++) {
-			lIt->second[i].write(ioStreamer, inIndent);
-		}
-		ioStreamer.closeTag();
-	}
+	mActionTable->writeStates(ioStreamer, inIndent);
 	ioStreamer.closeTag();
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::Choice::writeChoiceMap(PACC::XML::Streamer&, bool) const");
 }
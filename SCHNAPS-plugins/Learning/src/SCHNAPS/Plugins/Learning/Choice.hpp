@@ -22,12 +22,12 @@
 #define SCHNAPS_Plugins_Learning_Choice_hpp
 
 #include "SCHNAPS/Plugins/Learning/Action.hpp"
+#include "SCHNAPS/Plugins/Learning/ActionTable.hpp"
 #include "SCHNAPS/Plugins/Learning/LearningContext.hpp"
 
 #include "SCHNAPS/SCHNAPS.hpp"
 #include "PACC/PACC.hpp"
 
-#include <map>
 #include <vector>
 
 namespace SCHNAPS {
@@ -38,7 +38,7 @@ namespace Learning {
  *  \class Choice SCHNAPS/Plugins/Learning/Choice.hpp "SCHNAPS/Plugins/Learning/Choice.hpp"
  *  \brief Make choice among different options.
  */
-class Choice: public Core::Object, public std::map<std::string, std::vector<Action> > {
+class Choice: public Core::Object {
 private:
 	typedef std::pair<std::string, Core::AnyType::Handle> LocalVariable;
 	
@@ -87,29 +87,88 @@ public:
 	//! Write content of object to XML.
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
 	
-	//! Return the state computed using a specific learning context.
-	std::string computeState(LearningContext& ioContext) const;
+	//! Return the ID of state computed using a specific learning context.
+	unsigned int computeState(LearningContext& ioContext);
 	//! Return the reward computed using a specific learning context.
 	double computeReward(LearningContext& ioContext) const;
+	//! Push a frame with the local variables of reward function in a learning context, for computing a batch of rewards.
+	void openRewardFrame(LearningContext& ioContext, std::vector<Core::AnyType::Handle>& outFrame) const;
+	//! Return the reward computed using a specific learning context where the frame of reward function is pushed.
+	double computeRewardInFrame(LearningContext& ioContext, std::vector<Core::AnyType::Handle>& ioFrame) const;
 	
 	/*!
-	 * \brief  Return a reference to all actions in a specific state.
+	 * \brief  Return a const reference to the choice label.
+	 * \return A const reference to the choice label.
+	 */
+	const std::string& getLabel() const {
+		schnaps_StackTraceBeginM();
+		return mLabel;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Learning::Choice::getLabel() const");
+	}
+	
+	/*!
+	 * \brief  Return the ID of a specific state, adding it if necessary.
 	 * \param  inState A const reference to the specific state.
-	 * \return A reference to all actions in a specific state.
+	 * \return The ID of state.
 	 */
-	std::vector<Action>& getActions(const std::string& inState) {
+	unsigned int getStateID(const std::string& inState) {
 		schnaps_StackTraceBeginM();
-		if (this->find(inState) == this->end()) {
-			// unknown state, add it and all possible actions (options)
-			std::vector<Action> lActions;
-			lActions.reserve(mOptions.size());
-			for (unsigned int i = 0; i < mOptions.size(); i++) {
-				lActions.push_back(Action(mOptions[i]));
-			}
-			this->insert(std::pair<std::string, std::vector<Action> >(inState, lActions));
-		}
-		return (*this)[inState];
-		schnaps_StackTraceEndM("std::vector<SCHNAPS::Plugins::Learning::Action>& SCHNAPS::Plugins::Learning::Choice::getActions(const std::string&)");
+		return mActionTable->getStateID(inState, mOptions);
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::Choice::getStateID(const std::string&)");
+	}
+	
+	/*!
+	 * \brief  Return a const reference to the state of a specific ID.
+	 * \param  inStateID The ID of state.
+	 * \return A const reference to the state.
+	 */
+	const std::string& getState(unsigned int inStateID) const {
+		schnaps_StackTraceBeginM();
+		return mActionTable->getState(inStateID);
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Learning::Choice::getState(unsigned int) const");
+	}
+	
+	/*!
+	 * \brief  Return a reference to all actions in the state of a specific ID.
+	 * \param  inStateID The ID of state.
+	 * \return A reference to all actions in the state.
+	 */
+	std::vector<Action>& getActions(unsigned int inStateID) {
+		schnaps_StackTraceBeginM();
+		return mActionTable->getActions(inStateID);
+		schnaps_StackTraceEndM("std::vector<SCHNAPS::Plugins::Learning::Action>& SCHNAPS::Plugins::Learning::Choice::getActions(unsigned int)");
+	}
+	
+	/*!
+	 * \brief Add a reward to the statistics of an action in the state of a specific ID.
+	 * \param inStateID The ID of state.
+	 * \param inActionID The ID of action taken.
+	 * \param inReward The reward obtained.
+	 */
+	void update(unsigned int inStateID, unsigned int inActionID, double inReward) {
+		schnaps_StackTraceBeginM();
+		mActionTable->update(inStateID, inActionID, inReward);
+		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::Choice::update(unsigned int, unsigned int, double)");
+	}
+	
+	/*!
+	 * \brief  Return a reference to the statistics of actions per state.
+	 * \return A reference to the statistics of actions per state.
+	 */
+	ActionTable& getActionTable() {
+		schnaps_StackTraceBeginM();
+		return *mActionTable;
+		schnaps_StackTraceEndM("SCHNAPS::Plugins::Learning::ActionTable& SCHNAPS::Plugins::Learning::Choice::getActionTable()");
+	}
+	
+	/*!
+	 * \brief  Return a const reference to the statistics of actions per state.
+	 * \return A const reference to the statistics of actions per state.
+	 */
+	const ActionTable& getActionTable() const {
+		schnaps_StackTraceBeginM();
+		return *mActionTable;
+		schnaps_StackTraceEndM("const SCHNAPS::Plugins::Learning::ActionTable& SCHNAPS::Plugins::Learning::Choice::getActionTable() const");
 	}
 	
 private:
@@ -135,6 +194,7 @@ private:
 	std::vector<std::string> mOptions;	//!< The labels of all possible actions to be taken from that choice.
 	Function mFunctionState;			//!< The function to compute current state.
 	Function mFunctionReward;			//!< The function to compute the reward given for having taken an action. 
+	ActionTable::Handle mActionTable;	//!< The statistics of actions per state, shared by all copies of the choice.
 };
 } // end of Learning namespace
 } // end of Plugins namespace
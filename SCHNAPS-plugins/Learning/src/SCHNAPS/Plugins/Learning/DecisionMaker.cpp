@@ -28,7 +28,7 @@ using namespace Learning;
  * \brief Default constructor.
  */
 DecisionMaker::DecisionMaker() :
-	mOFS(NULL),
+	mExperiences(new ExperienceBuffer()),
 	mLearning(NULL),
 	mGEAS_Alpha(NULL)
 {}
@@ -38,7 +38,7 @@ DecisionMaker::DecisionMaker() :
  * \param inOriginal A const reference to the original decision maker.
  */
 DecisionMaker::DecisionMaker(const DecisionMaker& inOriginal) :
-	mOFS(inOriginal.mOFS),
+	mExperiences(new ExperienceBuffer()),
 	mLearning(inOriginal.mLearning),
 	mGEAS_Alpha(inOriginal.mGEAS_Alpha)
 {
@@ -46,6 +46,7 @@ DecisionMaker::DecisionMaker(const DecisionMaker& inOriginal) :
 	for (DecisionMaker::const_iterator lIt = inOriginal.begin(); lIt != inOriginal.end(); lIt++) {
 		insert(std::pair<std::string, Choice::Handle>(lIt->first, lIt->second));
 	}
+	indexChoices();
 	
 	mContext.setSystem(inOriginal.mContext.getSystemHandle());
 	mContext.setEnvironment(inOriginal.mContext.getEnvironmentHandle());
@@ -61,7 +62,6 @@ DecisionMaker::DecisionMaker(const DecisionMaker& inOriginal) :
  * \return A reference to the current object.
  */
 DecisionMaker& DecisionMaker::operator=(const DecisionMaker& inOriginal) {
-	mOFS = inOriginal.mOFS;
 	mLearning = inOriginal.mLearning;
 	mGEAS_Alpha = inOriginal.mGEAS_Alpha;
 	
@@ -69,6 +69,7 @@ DecisionMaker& DecisionMaker::operator=(const DecisionMaker& inOriginal) {
 	for (DecisionMaker::const_iterator lIt = inOriginal.begin(); lIt != inOriginal.end(); lIt++) {
 		insert(std::pair<std::string, Choice::Handle>(lIt->first, lIt->second));
 	}
+	indexChoices();
 	
 	mContext.setSystem(inOriginal.mContext.getSystemHandle());
 	mContext.setEnvironment(inOriginal.mContext.getEnvironmentHandle());
@@ -93,6 +94,7 @@ Core::Object::Handle DecisionMaker::deepCopy(const Core::System& inSystem) const
 	    lChoice = Core::castHandleT<Choice>(lIt->second->deepCopy(inSystem));
 		lCopy->insert(std::pair<std::string, Choice::Handle>(lIt->first.c_str(), lChoice));
 	}
+	lCopy->indexChoices();
 	
 	return lCopy;
 	schnaps_StackTraceEndM("SCHNAPS::Core::Object::Handle SCHNAPS::Plugins::Learning::DecisionMaker::deepCopy(const SCHNAPS::Core::System&) const");
@@ -125,6 +127,7 @@ void DecisionMaker::readWithSystem(PACC::XML::ConstIterator inIter, Core::System
 		this->insert(std::pair<std::string, Choice::Handle>(lChild->getAttribute("label"), new Choice()));
 		(*this)[lChild->getAttribute("label")]->readWithSystem(lChild, ioSystem);
 	}
+	indexChoices();
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -142,42 +145,44 @@ void DecisionMaker::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent)
 }
 
 /*!
- * \brief Open log file.
- * \param inFilename A const reference to the name of log file.
+ * \brief Remove all recorded experiences.
  */
-void DecisionMaker::open(const std::string& inFilename) {
+void DecisionMaker::clearExperiences() {
 	schnaps_StackTraceBeginM();
-	mOFS = new std::ofstream(inFilename.c_str());
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::open(const std::string&)");
+	mExperiences->clear();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::clearExperiences()");
 }
 
 /*!
- * \brief Close log file.
+ * \brief  Return the ID of a specific decision node.
+ * \param  inDecisionNode A const reference to the label of decision node.
+ * \return The ID of decision node.
+ * \throw  SCHNAPS::RunTimeException if decision node is not in decision maker.
  */
-void DecisionMaker::close() {
+unsigned int DecisionMaker::getDecisionNodeID(const std::string& inDecisionNode) const {
 	schnaps_StackTraceBeginM();
-	mOFS->close();
-	delete mOFS;
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::close()");
+	DecisionMaker::const_iterator lIterDecisionNode = this->find(inDecisionNode);
+	if (lIterDecisionNode == this->end()) {
+		throw schnaps_RunTimeExceptionM("Decision node '" + inDecisionNode + "' is not in decision maker; could not resolve its ID.");
+	}
+	// IDs are assigned in label order
+	return std::distance(this->begin(), lIterDecisionNode);
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::DecisionMaker::getDecisionNodeID(const std::string&) const");
 }
 
 /*!
  * \brief  Compute the reward associated to an individual according to specific information.
- * \param  inDecisionNode A const reference to the decision node where choice occured.
- * \param  inState A const reference to the state.
+ * \param  inDecisionNodeID The ID of decision node where choice occured.
+ * \param  inStateID The ID of state.
  * \param  inActionID The ID of action taken.
  * \param  inIndividualID The ID of individual on which decision occured.
  * \return The reward associated to an individual according to specific information.
  */
-double DecisionMaker::computeReward(const std::string& inDecisionNode, const std::string& inState, unsigned int inActionID, unsigned int inIndividualID) {
+double DecisionMaker::computeReward(unsigned int inDecisionNodeID, unsigned int inStateID, unsigned int inActionID, unsigned int inIndividualID) {
 	schnaps_StackTraceBeginM();
-	DecisionMaker::iterator lIterDecisionNode = this->find(inDecisionNode);
-	if (lIterDecisionNode == this->end()) {
-		throw schnaps_RunTimeExceptionM("Decision node '" + inDecisionNode + "' is not in decision maker; could not compute reward.");
-	}
 	// get choice learning data
-	Choice& lChoice = *(lIterDecisionNode->second);
-	std::vector<Action>& lActions = lChoice.getActions(inState);
+	Choice& lChoice = *mChoices[inDecisionNodeID];
+	std::vector<Action>& lActions = lChoice.getActions(inStateID);
 	
 	// set individual (using the absolute index part of its ID)
 	mContext.setIndividualByIndex(inIndividualID);
@@ -186,36 +191,95 @@ double DecisionMaker::computeReward(const std::string& inDecisionNode, const std
 	mContext.setActionLabel(lActions[inActionID].getLabel());
 	
 	// set state
-	mContext.setState(inState);
+	mContext.setState(lChoice.getState(inStateID));
 	
 	// compute reward
 	return lChoice.computeReward(mContext);
-	schnaps_StackTraceEndM("double SCHNAPS::Plugins::Learning::DecisionMaker::computeReward(const std::string&, const std::string&, unsigned int, unsigned int)");
+	schnaps_StackTraceEndM("double SCHNAPS::Plugins::Learning::DecisionMaker::computeReward(unsigned int, unsigned int, unsigned int, unsigned int)");
 }
 
 /*!
- * \brief Update information of a specific decision node.
- * \param inDecisionNode A const reference to the decision node where choice occured.
- * \param inState A const reference to the state.
- * \param inActionID The ID of action taken.
- * \param inReward The reward obtained in these conditions.
+ * \brief Compute the rewards of a batch of experiences made on a specific decision node.
+ * \param inDecisionNodeID The ID of decision node where choices occured.
+ * \param inExperiences A const reference to the experiences.
+ * \param inBegin The index of first experience of batch.
+ * \param inEnd The index after the last experience of batch.
+ * \param outRewards A reference to the rewards of experiences (same indexes).
+ *
+ * The local variables of reward function are inserted once for the whole batch.
  */
-void DecisionMaker::update(const std::string& inDecisionNode, const std::string& inState, unsigned int inActionID, double inReward) {
+void DecisionMaker::computeRewards(unsigned int inDecisionNodeID, const std::vector<const ExperienceBuffer::Experience*>& inExperiences, unsigned int inBegin, unsigned int inEnd, std::vector<double>& outRewards) {
 	schnaps_StackTraceBeginM();
-	DecisionMaker::iterator lIterDecisionNode = this->find(inDecisionNode);
-	if (lIterDecisionNode == this->end()) {
-		throw schnaps_RunTimeExceptionM("Decision node '" + inDecisionNode + "' is not in decision maker; could not update choice.");
+	if (inBegin >= inEnd) {
+		return;
 	}
+	
 	// get choice learning data
-	Choice& lChoice = *(lIterDecisionNode->second);
-	std::vector<Action>& lActions = lChoice.getActions(inState);
+	const Choice& lChoice = *mChoices[inDecisionNodeID];
+	std::vector<Core::AnyType::Handle> lFrame;
+	lChoice.openRewardFrame(mContext, lFrame);
+	
+	for (unsigned int i = inBegin; i < inEnd; i++) {
+		// set individual, action label and state
+		mContext.setIndividualByIndex(inExperiences[i]->mIndividualIndex);
+		mContext.setActionLabel(mChoices[inDecisionNodeID]->getActions(inExperiences[i]->mStateID)[inExperiences[i]->mActionID].getLabel());
+		mContext.setState(lChoice.getState(inExperiences[i]->mStateID));
+		
+		// compute reward
+		outRewards[i] = lChoice.computeRewardInFrame(mContext, lFrame);
+	}
 	
-	// update parameters
-	lActions[inActionID].setTried(true);
-	lActions[inActionID].setUpdatedTimes(lActions[inActionID].getUpdatedTimes() + 1);
-	lActions[inActionID].setReward(lActions[inActionID].getReward() + inReward);
-	lActions[inActionID].setReward2(lActions[inActionID].getReward2() + pow(inReward, 2));
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::update(const std::string&, const std::string&, unsigned int, double)");
+	mContext.popLocalFrame();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::computeRewards(unsigned int, const std::vector<const SCHNAPS::Plugins::Learning::ExperienceBuffer::Experience*>&, unsigned int, unsigned int, std::vector<double>&)");
+}
+
+/*!
+ * \brief Update information of a specific decision node (shared by the decision makers of all threads).
+ * \param inDecisionNodeID The ID of decision node where choice occured.
+ * \param inStateID The ID of state.
+ * \param inActionID The ID of action taken.
+ * \param inReward The reward obtained in these conditions.
+ */
+void DecisionMaker::update(unsigned int inDecisionNodeID, unsigned int inStateID, unsigned int inActionID, double inReward) {
+	schnaps_StackTraceBeginM();
+	// update statistics shared by all decision makers
+	mChoices[inDecisionNodeID]->update(inStateID, inActionID, inReward);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::update(unsigned int, unsigned int, unsigned int, double)");
+}
+
+/*!
+ * \brief Replace statistics of actions by a copy of the statistics of another decision maker.
+ * \param inOriginal A const reference to the original decision maker (read from the same model).
+ */
+void DecisionMaker::assignStatistics(const DecisionMaker& inOriginal) {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mChoices.size(); i++) {
+		mChoices[i]->getActionTable().assign(inOriginal.mChoices[i]->getActionTable());
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::assignStatistics(const SCHNAPS::Plugins::Learning::DecisionMaker&)");
+}
+
+/*!
+ * \brief Add the updates of another decision maker since its last merge.
+ * \param inDecisionMaker A const reference to the other decision maker (read from the same model).
+ */
+void DecisionMaker::mergeStatistics(const DecisionMaker& inDecisionMaker) {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mChoices.size(); i++) {
+		mChoices[i]->getActionTable().mergeUpdates(inDecisionMaker.mChoices[i]->getActionTable());
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::mergeStatistics(const SCHNAPS::Plugins::Learning::DecisionMaker&)");
+}
+
+/*!
+ * \brief Forget updates since last merge.
+ */
+void DecisionMaker::clearUpdates() {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mChoices.size(); i++) {
+		mChoices[i]->getActionTable().clearUpdates();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::clearUpdates()");
 }
 
 /*!
@@ -261,3 +325,18 @@ void DecisionMaker::setThreadNb(unsigned int inThreadNb) {
 	mContext.setThreadNb(inThreadNb);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::setThreadNb(unsigned int)");
 }
+
+// private
+
+/*!
+ * \brief Assign IDs to decision nodes, in label order.
+ */
+void DecisionMaker::indexChoices() {
+	schnaps_StackTraceBeginM();
+	mChoices.clear();
+	mChoices.reserve(this->size());
+	for (DecisionMaker::const_iterator lIt = this->begin(); lIt != this->end(); lIt++) {
+		mChoices.push_back(lIt->second);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionMaker::indexChoices()");
+}
@@ -23,6 +23,7 @@
 
 #include "SCHNAPS/Plugins/Learning/Action.hpp"
 #include "SCHNAPS/Plugins/Learning/Choice.hpp"
+#include "SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp"
 #include "SCHNAPS/Plugins/Learning/LearningContext.hpp"
 
 #include "SCHNAPS/SCHNAPS.hpp"
@@ -73,14 +74,23 @@ public:
 	//! Write content of object to XML.
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
 	
-	//! Open log file.
-	void open(const std::string& inFileName);
-	//! Close log file.
-	void close();
+	//! Remove all recorded experiences.
+	void clearExperiences();
+	//! Return the ID of a specific decision node.
+	unsigned int getDecisionNodeID(const std::string& inDecisionNode) const;
 	//! Compute the reward associated to an individual according to specific information.
-	double computeReward(const std::string& inDecisionNode, const std::string& inState, unsigned int inActionID, unsigned int inIndividualID);
+	double computeReward(unsigned int inDecisionNodeID, unsigned int inStateID, unsigned int inActionID, unsigned int inIndividualID);
+	//! Compute the rewards of a batch of experiences made on a specific decision node.
+	void computeRewards(unsigned int inDecisionNodeID, const std::vector<const ExperienceBuffer::Experience*>& inExperiences, unsigned int inBegin, unsigned int inEnd, std::vector<double>& outRewards);
 	//! Update information of a specific decision node.
-	void update(const std::string& inDecisionNode, const std::string& inState, unsigned int inActionID, double inReward);
+	void update(unsigned int inDecisionNodeID, unsigned int inStateID, unsigned int inActionID, double inReward);
+	
+	//! Replace statistics of actions by a copy of the statistics of another decision maker.
+	void assignStatistics(const DecisionMaker& inOriginal);
+	//! Add the updates of another decision maker since its last merge.
+	void mergeStatistics(const DecisionMaker& inDecisionMaker);
+	//! Forget updates since last merge.
+	void clearUpdates();
 	
 	//! Set the system.
 	void setSystem(Core::System::Handle inSystem);
@@ -91,27 +101,43 @@ public:
 	//! Set the thread number associated.
 	void setThreadNb(unsigned int inThreadNb);
 	
+	/*!
+	 * \brief  Return a handle to the experiences recorded in learning mode.
+	 * \return A handle to the experiences recorded in learning mode.
+	 */
+	ExperienceBuffer::Handle getExperiences() {
+		schnaps_StackTraceBeginM();
+		return mExperiences;
+		schnaps_StackTraceEndM("SCHNAPS::Plugins::Learning::ExperienceBuffer::Handle SCHNAPS::Plugins::Learning::DecisionMaker::getExperiences()");
+	}
+	
+	/*!
+	 * \brief  Return a const reference to the choice of a specific decision node.
+	 * \param  inDecisionNodeID The ID of decision node.
+	 * \return A const reference to the choice of decision node.
+	 */
+	const Choice& getChoice(unsigned int inDecisionNodeID) const {
+		schnaps_StackTraceBeginM();
+		return *mChoices[inDecisionNodeID];
+		schnaps_StackTraceEndM("const SCHNAPS::Plugins::Learning::Choice& SCHNAPS::Plugins::Learning::DecisionMaker::getChoice(unsigned int) const");
+	}
+	
 	/*!
 	 * \brief  Return the index of next action to execute in specific decision node.
-	 * \param  inDecisionNode A const reference to the decision node.
+	 * \param  inDecisionNodeID The ID of decision node (see getDecisionNodeID).
 	 * \param  inIndividual A handle to the current individual processing.
 	 * \return The index of next action to execute in specific decision node.
-	 * \throw  SCHNAPS::RunTimeException if decision node is not in decision maker.
 	 */
-	unsigned int getActionID(const std::string& inDecisionNode, Simulation::Individual::Handle inIndividual) {
+	unsigned int getActionID(unsigned int inDecisionNodeID, Simulation::Individual::Handle inIndividual) {
 		schnaps_StackTraceBeginM();
-		DecisionMaker::iterator lIterDecisionNode = this->find(inDecisionNode);
-		if (lIterDecisionNode == this->end()) {
-			throw schnaps_RunTimeExceptionM("Decision node '" + inDecisionNode + "' is not in decision maker; could not make choice.");
-		}
 		// get choice learning data
-		Choice& lChoice = *(lIterDecisionNode->second);
+		Choice& lChoice = *mChoices[inDecisionNodeID];
 		
 		// set current individual in learning context
 		mContext.setIndividual(inIndividual);
 		
 		// compute current state
-		std::string lCurrentState = lChoice.computeState(mContext);
+		unsigned int lCurrentState = lChoice.computeState(mContext);
 		
 		// get action stats for that state
 		std::vector<Action>& lActions = lChoice.getActions(lCurrentState);
@@ -178,9 +204,8 @@ public:
 				}
 			}
 			
-			// log move
-			(*mOFS) << inDecisionNode << "," << lCurrentState << "," << lActionID << "," << inIndividual->getIndex() << "\n";
-			mOFS->flush();
+			// record move
+			mExperiences->push_back(inDecisionNodeID, lCurrentState, lActionID, inIndividual->getIndex());
 		} else {
 			
 			// exploitation mode = action with best mean
@@ -209,12 +234,16 @@ public:
 		}
 		
 		return lActionID;
-		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::DecisionMaker::getActionID(const std::string&, SCHNAPS::Plugins::Simulation::Individual::Handle)");
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::DecisionMaker::getActionID(unsigned int, SCHNAPS::Plugins::Simulation::Individual::Handle)");
 	}
 	
 private:
+	//! Assign IDs to decision nodes, in label order.
+	void indexChoices();
+	
+	std::vector<Choice::Handle> mChoices;	//!< Choices of decision nodes, indexed by ID.
 	LearningContext mContext;			//!< The execution context used for computation of functions.
-	std::ofstream *mOFS;				//!< A pointer to the output log file.
+	ExperienceBuffer::Handle mExperiences;	//!< A handle to the experiences recorded in learning mode.
 	Core::Bool::Handle mLearning;		//!< A handle indicating if learning mode is activated (else it is exploitation mode).
 	Core::Double::Handle mGEAS_Alpha;	//!< A handle to the alpha parameter of GEAS.
 };
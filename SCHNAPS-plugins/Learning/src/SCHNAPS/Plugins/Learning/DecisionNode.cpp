@@ -29,7 +29,8 @@ using namespace Learning;
  */
 DecisionNode::DecisionNode() :
 	Primitive(), // unknown number of children
-	mLabel("")
+	mLabel(""),
+	mDecisionNodeID(0)
 {}
 
 /*!
@@ -38,7 +39,8 @@ DecisionNode::DecisionNode() :
  */
 DecisionNode::DecisionNode(const DecisionNode& inOriginal) :
 	Primitive(inOriginal.getNumberArguments()),
-	mLabel(inOriginal.mLabel.c_str())
+	mLabel(inOriginal.mLabel.c_str()),
+	mDecisionNodeID(inOriginal.mDecisionNodeID)
 {}
 
 /*!
@@ -49,6 +51,7 @@ DecisionNode& DecisionNode::operator=(const DecisionNode& inOriginal) {
 	schnaps_StackTraceBeginM();
 	setNumberArguments(inOriginal.getNumberArguments());
 	mLabel.assign(inOriginal.mLabel.c_str());
+	mDecisionNodeID = inOriginal.mDecisionNodeID;
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Learning::DecisionNode& SCHNAPS::Plugins::Learning::DecisionNode::operator=(const SCHNAPS::Plugins::Learning::DecisionNode&)");
 }
@@ -59,6 +62,7 @@ DecisionNode& DecisionNode::operator=(const DecisionNode& inOriginal) {
  * \param ioSystem A reference to the system.
  * \throw SCHNAPS::Core::IOException if a wrong tag is encountered.
  * \throw SCHNAPS::Core::IOException if inLabel attribute is missing.
+ * \throw SCHNAPS::Core::RunTimeException if the decision node is not in learning module.
  */
 void DecisionNode::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSystem) {
 	schnaps_StackTraceBeginM();
@@ -77,6 +81,9 @@ void DecisionNode::readWithSystem(PACC::XML::ConstIterator inIter, Core::System&
 		throw schnaps_IOExceptionNodeM(*inIter, "DecisionNode label expected!");
 	}
 	mLabel.assign(inIter->getAttribute("inLabel"));
+	
+	// resolve ID of decision node (learning module is read with system, before processes)
+	mDecisionNodeID = Core::castObjectT<LearningModule&>(ioSystem.getComponent("Learning_LearningModule")).getDecisionNodeID(mLabel);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::DecisionNode::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -101,7 +108,7 @@ Core::AnyType::Handle DecisionNode::execute(unsigned int inIndex, Core::Executio
 	schnaps_StackTraceBeginM();
 	Simulation::SimulationContext& lContext = Core::castObjectT<Simulation::SimulationContext&>(ioContext);
 	// call the learning module to get the index of action to execute
-	unsigned int lActionIndex = Core::castObjectT<LearningModule&>(ioContext.getComponent("Learning_LearningModule")).getActionID(mLabel, lContext);
+	unsigned int lActionIndex = Core::castObjectT<LearningModule&>(ioContext.getComponent("Learning_LearningModule")).getActionID(mDecisionNodeID, lContext);
 	return getArgument(inIndex, lActionIndex, ioContext);
 	schnaps_StackTraceEndM("Core::AnyType::Handle SCHNAPS::Plugins::Learning::DecisionNode::execute(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
@@ -75,7 +75,8 @@ public:
 	virtual const std::string& getReturnType(unsigned int inIndex, Core::ExecutionContext& ioContext) const;
 	
 private:
-	std::string mLabel;
+	std::string mLabel;				//!< Label of decision node.
+	unsigned int mDecisionNodeID;	//!< ID of decision node in learning module, resolved when read.
 };
 } // end of Learning namespace
 } // end of Plugins namespace
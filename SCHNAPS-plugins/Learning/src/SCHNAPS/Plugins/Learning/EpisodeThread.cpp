@@ -0,0 +1,151 @@
+/*
+ * EpisodeThread.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Learning/Learning.hpp"
+
+#ifdef SCHNAPS_IS_UNIX
+#include <sys/stat.h>
+#else
+#include <direct.h>
+#endif
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Learning;
+
+/*!
+ * \brief Construct a thread and start running episodes.
+ * \param ioSimulator A reference to the simulator used (with its learning module set up).
+ * \param inScenario A const reference to the label of scenario simulated.
+ * \param inInput A const reference to the learning input population.
+ * \param inConfiguration A const reference to the learning configuration.
+ * \param inPrintPrefix A const reference to the basic print prefix.
+ * \param inFolders Indicates if the outputs of each episode are written in a separate folder.
+ * \param inSeed The seed of the run (0 for random).
+ * \param inEpisodes A const reference to the indexes of episodes to run, in order.
+ * \param outError A reference to the explanation of error that stopped the episodes (left empty if none).
+ */
+EpisodeThread::EpisodeThread(Simulation::Simulator& ioSimulator,
+		const std::string& inScenario,
+		const std::string& inInput,
+		const std::string& inConfiguration,
+		const std::string& inPrintPrefix,
+		bool inFolders,
+		unsigned long inSeed,
+		const std::vector<unsigned int>& inEpisodes,
+		std::string& outError) :
+	mSimulator(&ioSimulator),
+	mLearningModule(Core::castHandleT<LearningModule>(ioSimulator.getSystem().getComponentHandle("Learning_LearningModule"))),
+	mScenario(inScenario.c_str()),
+	mInput(inInput.c_str()),
+	mConfiguration(inConfiguration.c_str()),
+	mPrintPrefix(inPrintPrefix.c_str()),
+	mFolders(inFolders),
+	mSeed(inSeed),
+	mEpisodes(inEpisodes),
+	mError(&outError)
+{
+	mError->clear();
+	run();
+}
+
+/*!
+ * \brief Destructor, waits for the episodes to end.
+ */
+EpisodeThread::~EpisodeThread() {
+	wait();
+}
+
+/*!
+ * \brief Run the episodes of thread, recording the error that stops them if any.
+ *
+ * Exceptions cannot cross the thread, so they are explained in the error string, to be reported
+ * by the caller once the thread is joined.
+ */
+void EpisodeThread::main() {
+	try {
+		runEpisodes();
+	} catch (Core::Exception& inException) {
+		std::ostringstream lOSS;
+		inException.explain(lOSS);
+		mError->assign(lOSS.str());
+	} catch (std::exception& inException) {
+		mError->assign(inException.what());
+	}
+}
+
+/*!
+ * \brief Run all episodes, in order.
+ *
+ * The randomizers of episode i are seeded from 2*i and 2*i+1 above the seed of the run, so that an
+ * episode gives the same result whatever the simulator it is run on.
+ */
+void EpisodeThread::runEpisodes() {
+	schnaps_StackTraceBeginM();
+	std::stringstream lSS;
+	
+	for (unsigned int i = 0; i < mEpisodes.size(); i++) {
+		// seed randomizers of episode
+		if (mSeed == 0) {
+			mSimulator->clearRandomizer();
+			mSimulator->getPopulationManager().getGenerator().clearRandomizer();
+		} else {
+			mSimulator->seedRandomizer(mSeed + 2 * mEpisodes[i]);
+			mSimulator->getPopulationManager().getGenerator().seedRandomizer(mSeed + 2 * mEpisodes[i] + 1);
+		}
+		
+		// reset configuration for learning
+		mSimulator->configure(mConfiguration);
+		
+		// set population to learning input
+		mSimulator->getPopulationManager().clear();
+		mSimulator->getPopulationManager().readStr(mInput);
+		
+		// set print prefix for episode
+		if (mFolders) {
+			// create folder for episode
+			lSS.str("");
+			lSS << mPrintPrefix << mEpisodes[i] << "/";
+#ifdef SCHNAPS_IS_UNIX
+			mkdir(lSS.str().c_str(), 0777);
+#else
+			mkdir(lSS.str().c_str());
+#endif
+			lSS.str("");
+			lSS << "print.prefix=" << mPrintPrefix << mEpisodes[i] << "/";
+		} else {
+			lSS.str("");
+			lSS << "print.prefix=" << mPrintPrefix << mEpisodes[i] << "_";
+		}
+		mSimulator->configure(lSS.str().c_str());
+		
+		// clear experiences of previous episode
+		mLearningModule->clear();
+		
+		// run simulation (for learning)
+		mSimulator->simulate(mScenario);
+		
+		// update state-action values (and write learning log files if required)
+		lSS.str("");
+		lSS << mPrintPrefix << "LearningLog" << mEpisodes[i];
+		mLearningModule->update(lSS.str());
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::EpisodeThread::runEpisodes()");
+}
@@ -0,0 +1,86 @@
+/*
+ * EpisodeThread.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Learning_EpisodeThread_hpp
+#define SCHNAPS_Plugins_Learning_EpisodeThread_hpp
+
+#include "SCHNAPS/Plugins/Learning/LearningModule.hpp"
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "PACC/PACC.hpp"
+
+#include <string>
+#include <vector>
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Learning {
+
+/*!
+ *  \class EpisodeThread SCHNAPS/Plugins/Learning/EpisodeThread.hpp "SCHNAPS/Plugins/Learning/EpisodeThread.hpp"
+ *  \brief Thread for running learning episodes on a simulator, concurrently with other simulators.
+ *
+ *  Episodes are run one after another in background; the simulator must not be used by other threads
+ *  before the thread is destroyed (which waits for the episodes to end). An exception stops the episodes
+ *  of thread and is explained in the error string given, to be reported once the thread is joined.
+ */
+class EpisodeThread: public Core::Object, public PACC::Threading::Thread {
+public:
+	//! EpisodeThread allocator type.
+	typedef Core::AllocatorT<EpisodeThread, Core::Object::Alloc> Alloc;
+	//! EpisodeThread handle type.
+	typedef Core::PointerT<EpisodeThread, Core::Object::Handle> Handle;
+	//! EpisodeThread bag type.
+	typedef Core::ContainerT<EpisodeThread, Core::Object::Bag> Bag;
+
+	EpisodeThread(Simulation::Simulator& ioSimulator,
+		const std::string& inScenario,
+		const std::string& inInput,
+		const std::string& inConfiguration,
+		const std::string& inPrintPrefix,
+		bool inFolders,
+		unsigned long inSeed,
+		const std::vector<unsigned int>& inEpisodes,
+		std::string& outError);
+	~EpisodeThread();
+
+protected:
+	void main();
+
+private:
+	//! Run all episodes, in order.
+	void runEpisodes();
+
+	Simulation::Simulator* mSimulator;			//!< A pointer to the simulator used.
+	LearningModule::Handle mLearningModule;		//!< A handle to the learning module of simulator.
+	std::string mScenario;						//!< The label of scenario simulated.
+	std::string mInput;							//!< The learning input population.
+	std::string mConfiguration;					//!< The learning configuration.
+	std::string mPrintPrefix;					//!< The basic print prefix.
+	bool mFolders;								//!< Indicates if the outputs of each episode are written in a separate folder.
+	unsigned long mSeed;						//!< The seed of the run (0 for random).
+	std::vector<unsigned int> mEpisodes;		//!< The indexes of episodes to run, in order.
+	std::string* mError;						//!< A pointer to the explanation of error that stopped the episodes (empty if none).
+};
+} // end of Learning namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Learning_EpisodeThread_hpp */
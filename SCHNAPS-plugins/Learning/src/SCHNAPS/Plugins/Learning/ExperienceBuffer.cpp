@@ -0,0 +1,34 @@
+/*
+ * ExperienceBuffer.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Learning/Learning.hpp"
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Learning;
+
+/*!
+ * \brief Remove all experiences from buffer.
+ */
+void ExperienceBuffer::clear() {
+	schnaps_StackTraceBeginM();
+	mExperiences.clear();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ExperienceBuffer::clear()");
+}
@@ -0,0 +1,119 @@
+/*
+ * ExperienceBuffer.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Learning_ExperienceBuffer_hpp
+#define SCHNAPS_Plugins_Learning_ExperienceBuffer_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "PACC/PACC.hpp"
+
+#include <vector>
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Learning {
+
+/*!
+ *  \class ExperienceBuffer SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp "SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp"
+ *  \brief In-memory record of the decisions made by a decision maker during an episode.
+ *
+ *  Decision nodes and states are referred to by their ID, so that recording a decision never
+ *  formats nor allocates a string.
+ */
+class ExperienceBuffer: public Core::Object {
+public:
+	/*!
+	 * \struct Experience SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp "SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp"
+	 * \brief  A decision made on an individual.
+	 */
+	struct Experience {
+		unsigned int mDecisionNodeID;	//!< The ID of decision node where choice occured.
+		unsigned int mStateID;			//!< The ID of state in which choice occured.
+		unsigned int mActionID;			//!< The ID of action taken.
+		unsigned int mIndividualIndex;	//!< The index of individual on which decision occured.
+	};
+
+	//! ExperienceBuffer allocator type.
+	typedef Core::AllocatorT<ExperienceBuffer, Core::Object::Alloc> Alloc;
+	//! ExperienceBuffer handle type.
+	typedef Core::PointerT<ExperienceBuffer, Core::Object::Handle> Handle;
+	//! ExperienceBuffer bag type.
+	typedef Core::ContainerT<ExperienceBuffer, Core::Object::Bag> Bag;
+
+	ExperienceBuffer() {}
+	virtual ~ExperienceBuffer() {}
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Learning_ExperienceBuffer");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Learning::ExperienceBuffer::getName() const");
+	}
+
+	//! Remove all experiences from buffer.
+	void clear();
+
+	/*!
+	 * \brief Record a decision.
+	 * \param inDecisionNodeID The ID of decision node where choice occured.
+	 * \param inStateID The ID of state in which choice occured.
+	 * \param inActionID The ID of action taken.
+	 * \param inIndividualIndex The index of individual on which decision occured.
+	 */
+	void push_back(unsigned int inDecisionNodeID, unsigned int inStateID, unsigned int inActionID, unsigned int inIndividualIndex) {
+		schnaps_StackTraceBeginM();
+		Experience lExperience;
+		lExperience.mDecisionNodeID = inDecisionNodeID;
+		lExperience.mStateID = inStateID;
+		lExperience.mActionID = inActionID;
+		lExperience.mIndividualIndex = inIndividualIndex;
+		mExperiences.push_back(lExperience);
+		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::ExperienceBuffer::push_back(unsigned int, unsigned int, unsigned int, unsigned int)");
+	}
+
+	/*!
+	 * \brief  Return the number of experiences in buffer.
+	 * \return The number of experiences in buffer.
+	 */
+	unsigned int size() const {
+		return mExperiences.size();
+	}
+
+	/*!
+	 * \brief  Return a const reference to a specific experience.
+	 * \param  inIndex The index of experience.
+	 * \return A const reference to the experience.
+	 */
+	const Experience& operator[](unsigned int inIndex) const {
+		return mExperiences[inIndex];
+	}
+
+private:
+	std::vector<Experience> mExperiences;	//!< Recorded decisions, in order of occurence.
+};
+} // end of Learning namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Learning_ExperienceBuffer_hpp */
@@ -24,11 +24,15 @@
 #include "SCHNAPS/Plugins/Learning/config.hpp"
 
 #include "SCHNAPS/Plugins/Learning/Action.hpp"
+#include "SCHNAPS/Plugins/Learning/ActionTable.hpp"
 #include "SCHNAPS/Plugins/Learning/Choice.hpp"
 #include "SCHNAPS/Plugins/Learning/DecisionMaker.hpp"
 #include "SCHNAPS/Plugins/Learning/DecisionNode.hpp"
+#include "SCHNAPS/Plugins/Learning/EpisodeThread.hpp"
+#include "SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp"
 #include "SCHNAPS/Plugins/Learning/LearningContext.hpp"
 #include "SCHNAPS/Plugins/Learning/LearningModule.hpp"
+#include "SCHNAPS/Plugins/Learning/LogThread.hpp"
 #include "SCHNAPS/Plugins/Learning/State.hpp"
 #include "SCHNAPS/Plugins/Learning/UpdateThread.hpp"
 
@@ -27,7 +27,8 @@ using namespace Learning;
 /*!
  * \brief Default constructor.
  */
-LearningModule::LearningModule()
+LearningModule::LearningModule() :
+	mLog(NULL)
 {
 	mDecisionMakers.push_back(new DecisionMaker());
 	mDecisionMakers.back()->setThreadNb(0);
@@ -38,7 +39,8 @@ LearningModule::LearningModule()
  * \param inOriginal A const reference to the original branching primitive.
  */
 LearningModule::LearningModule(const LearningModule& inOriginal) :
-	mDecisionMakers(inOriginal.mDecisionMakers)
+	mDecisionMakers(inOriginal.mDecisionMakers),
+	mLog(inOriginal.mLog)
 {}
 
 /*!
@@ -116,37 +118,35 @@ void LearningModule::init(Core::System& ioSystem) {
 }
 
 /*!
- * \brief Open decision makers log files in learning module.
- * \param inFileName A const reference to the common filename.
+ * \brief Remove experiences recorded by decision makers in learning module.
  */
-void LearningModule::open(const std::string& inFileName) {
+void LearningModule::clear() {
 	schnaps_StackTraceBeginM();
-	std::stringstream lSS;
 	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
-		lSS.str("");
-		lSS << inFileName << "_" << i;
-		mDecisionMakers[i]->open(lSS.str());
+		mDecisionMakers[i]->clearExperiences();
 	}
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::open(const std::string&)");
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::clear()");
 }
 
 /*!
- * \brief Close decision makers log files in learning module.
- */
-void LearningModule::close() {
-	schnaps_StackTraceBeginM();
-	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
-		mDecisionMakers[i]->close();
-	}
-	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::clost()");
-}
-
-/*!
- * \brief Update decision makers in learning module from specific log files.
- * \param inFileName A const reference to the common filename.
+ * \brief Update decision makers in learning module from recorded experiences.
+ * \param inFileName A const reference to the common filename of text logs (written only if learning.log is true).
+ *
+ * Text logs are written in background while updating, then experiences are cleared.
  */
 void LearningModule::update(const std::string& inFileName) {
 	schnaps_StackTraceBeginM();
+	std::stringstream lSS;
+	
+	// write text logs in background
+	LogThread::Bag lLogThreads;
+	if (mLog != NULL && mLog->getValue()) {
+		for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
+			lSS.str("");
+			lSS << inFileName << "_" << i;
+			lLogThreads.push_back(new LogThread(mDecisionMakers[i], lSS.str()));
+		}
+	}
 	
 #ifdef PARALLEL_UPDATE
 	// multi-thread parallel update
@@ -158,24 +158,19 @@ void LearningModule::update(const std::string& inFileName) {
 	// thread semaphore for triggering sequential execution in update process
 	PACC::Threading::Semaphore* lSequential = new PACC::Threading::Semaphore(0);
 	
-	std::stringstream lSS;
-	
 	// create one subthread per decision maker
 	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
-		lSS.str("");
-		lSS << inFileName << "_" << i;
-		
-		lSubThreads.push_back(new UpdateThread(lParallel, lSequential, lSS.str()));
+		lSubThreads.push_back(new UpdateThread(lParallel, lSequential, mDecisionMakers[i]->getExperiences()));
 		lSequential->wait();
 		
 		// set the current decision maker of subthread
 		lSubThreads.back()->setDecisionMaker(mDecisionMakers[i]);
 		
 		// set position of subthread
-		lSubThreads.back()->setPosition(UpdateThread::eREADANDUPDATE);
+		lSubThreads.back()->setPosition(UpdateThread::eUPDATE);
 	}
 	
-	// launch read and update step and wait
+	// launch update step and wait
 	lParallel->lock();
 	lParallel->broadcast();
 	lParallel->unlock();
@@ -183,26 +178,6 @@ void LearningModule::update(const std::string& inFileName) {
 		lSequential->wait();
 	}
 	
-	// rotate decision makers and update
-	for (unsigned int i = 1; i < mDecisionMakers.size(); i++) {
-		for (unsigned int j = 0; j < lSubThreads.size(); j++) {
-			// set the current decision maker of subthread
-			lSubThreads[j]->setDecisionMaker(mDecisionMakers[(j+i)%mDecisionMakers.size()]);
-
-			// set position of subthread
-			lSubThreads[j]->setPosition(UpdateThread::eUPDATE);
-		}
-		
-		
-		// launch update step and wait
-		lParallel->lock();
-		lParallel->broadcast();
-		lParallel->unlock();
-		for (unsigned int j = 0; j < lSubThreads.size(); j++) {
-			lSequential->wait();
-		}
-	}
-	
 	// terminate subthreads
 	for (unsigned int i = 0; i < lSubThreads.size(); i++) {
 		lSubThreads[i]->setPosition(UpdateThread::eEND);
@@ -211,45 +186,116 @@ void LearningModule::update(const std::string& inFileName) {
 	lParallel->broadcast();
 	lParallel->unlock();
 #else
-	// sequential update
-	std::stringstream lSS;
-	std::ifstream *lIFS;
-	PACC::Tokenizer *lTokenizer;
-	std::string lDecisionNode, lState, lActionIndex, lIndividualIndex;
-	unsigned lActionID, lIndividualID;
-	double lReward;
+	// batched update
+	// rewards are computed by decision node, each batch being split among one subthread per decision maker
 	
+	// group experiences by decision node (counting sort, keeps recording order within a decision node)
+	UpdateThread::Batch lBatch;
+	ExperienceBuffer::Handle lExperiences;
+	lBatch.mOffsets.assign(mDecisionMakers[0]->size() + 1, 0);
 	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
-		lSS.str("");
-		lSS << inFileName << "_" << i;
-		
-		lIFS = new std::ifstream(lSS.str().c_str());
-		lTokenizer = new PACC::Tokenizer(*lIFS);
-		lTokenizer->setDelimiters(",\n", "");
+		lExperiences = mDecisionMakers[i]->getExperiences();
+		for (unsigned int j = 0; j < lExperiences->size(); j++) {
+			lBatch.mOffsets[(*lExperiences)[j].mDecisionNodeID + 1]++;
+		}
+	}
+	for (unsigned int i = 1; i < lBatch.mOffsets.size(); i++) {
+		lBatch.mOffsets[i] += lBatch.mOffsets[i - 1];
+	}
+	lBatch.mExperiences.resize(lBatch.mOffsets.back());
+	lBatch.mRewards.resize(lBatch.mOffsets.back());
+	std::vector<unsigned int> lNext(lBatch.mOffsets.begin(), lBatch.mOffsets.end() - 1);
+	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
+		lExperiences = mDecisionMakers[i]->getExperiences();
+		for (unsigned int j = 0; j < lExperiences->size(); j++) {
+			lBatch.mExperiences[lNext[(*lExperiences)[j].mDecisionNodeID]++] = &(*lExperiences)[j];
+		}
+	}
+	
+	if (lBatch.mExperiences.empty() == false) {
+		// subthreads used when computing rewards
+		UpdateThread::Bag lSubThreads;
+		// thread condition for triggering parallel execution in update process
+		PACC::Threading::Condition* lParallel = new PACC::Threading::Condition();
+		// thread semaphore for triggering sequential execution in update process
+		PACC::Threading::Semaphore* lSequential = new PACC::Threading::Semaphore(0);
 		
-		while (lTokenizer->getNextToken(lDecisionNode)) {
-			lTokenizer->getNextToken(lState);
-			lTokenizer->getNextToken(lActionIndex);
-			lTokenizer->getNextToken(lIndividualIndex);
-			
-			lActionID = SCHNAPS::str2uint(lActionIndex);
-			lIndividualID = SCHNAPS::str2uint(lIndividualIndex);
-			
-			lReward = mDecisionMakers[i]->computeReward(lDecisionNode, lState, lActionID, lIndividualID);
+		// create one subthread per decision maker (each one having its own context)
+		for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
+			lSubThreads.push_back(new UpdateThread(lParallel, lSequential, NULL));
+			lSequential->wait();
 			
-			for (unsigned int j = 0; j < mDecisionMakers.size(); j++) {
-				mDecisionMakers[j]->update(lDecisionNode, lState, lActionID, lReward);
-			}
+			lSubThreads.back()->setDecisionMaker(mDecisionMakers[i]);
+			lSubThreads.back()->setBatch(&lBatch, i, mDecisionMakers.size());
+			lSubThreads.back()->setPosition(UpdateThread::eREWARD);
+		}
+		
+		// launch reward step and wait
+		lParallel->lock();
+		lParallel->broadcast();
+		lParallel->unlock();
+		for (unsigned int i = 0; i < lSubThreads.size(); i++) {
+			lSequential->wait();
 		}
 		
-		lIFS->close();
-		delete lTokenizer;
-		delete lIFS;
+		// terminate subthreads
+		for (unsigned int i = 0; i < lSubThreads.size(); i++) {
+			lSubThreads[i]->setPosition(UpdateThread::eEND);
+		}
+		lParallel->lock();
+		lParallel->broadcast();
+		lParallel->unlock();
+		lSubThreads.clear();
+		delete lParallel;
+		delete lSequential;
+	}
+	
+	// update statistics (shared by all decision makers) sequentially
+	// the experiences of an action are all on the same decision node, so rewards are summed in recording order
+	for (unsigned int i = 0; i < lBatch.mExperiences.size(); i++) {
+		mDecisionMakers[0]->update(lBatch.mExperiences[i]->mDecisionNodeID, lBatch.mExperiences[i]->mStateID, lBatch.mExperiences[i]->mActionID, lBatch.mRewards[i]);
 	}
 #endif
+	
+	// wait for text logs before clearing experiences
+	lLogThreads.clear();
+	clear();
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::update(const std::string&)");
 }
 
+/*!
+ * \brief Replace statistics of actions by a copy of the statistics of another learning module.
+ * \param inOriginal A const reference to the original learning module (read from the same model).
+ *
+ * Statistics are shared by the decision makers of all threads, so only the first one is used.
+ */
+void LearningModule::assignStatistics(const LearningModule& inOriginal) {
+	schnaps_StackTraceBeginM();
+	mDecisionMakers[0]->assignStatistics(*inOriginal.mDecisionMakers[0]);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::assignStatistics(const SCHNAPS::Plugins::Learning::LearningModule&)");
+}
+
+/*!
+ * \brief Add the updates of another learning module since its last merge.
+ * \param inLearningModule A const reference to the other learning module (read from the same model).
+ *
+ * Statistics are shared by the decision makers of all threads, so only the first one is used.
+ */
+void LearningModule::mergeStatistics(const LearningModule& inLearningModule) {
+	schnaps_StackTraceBeginM();
+	mDecisionMakers[0]->mergeStatistics(*inLearningModule.mDecisionMakers[0]);
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::mergeStatistics(const SCHNAPS::Plugins::Learning::LearningModule&)");
+}
+
+/*!
+ * \brief Forget updates since last merge.
+ */
+void LearningModule::clearUpdates() {
+	schnaps_StackTraceBeginM();
+	mDecisionMakers[0]->clearUpdates();
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::clearUpdates()");
+}
+
 /*!
  * \brief Set the system of decision makers in learning module.
  * \param inSystem A handle to the system.
@@ -259,6 +305,9 @@ void LearningModule::setSystem(Core::System::Handle inSystem) {
 	for (unsigned int i = 0; i < mDecisionMakers.size(); i++) {
 		mDecisionMakers[i]->setSystem(inSystem);
 	}
+	if (inSystem != NULL) {
+		mLog = Core::castHandleT<Core::Bool>(inSystem->getParameters().getParameterHandle("learning.log"));
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::LearningModule::setSystem(SCHNAPS::Core::System::Handle)");
 }
 
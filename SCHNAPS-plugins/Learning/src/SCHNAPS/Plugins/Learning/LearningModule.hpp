@@ -66,13 +66,18 @@ public:
 	//! Initialize the component.
 	virtual void init(Core::System& ioSystem);
 	
-	//! Open decision makers log files in learning module.
-	void open(const std::string& inFileName);
-	//! Close decision makers log files in learning module.
-	void close();
-	//! Update decision makers in learning module from specific log files.
+	//! Remove experiences recorded by decision makers in learning module.
+	void clear();
+	//! Update decision makers in learning module from recorded experiences.
 	void update(const std::string& inFileName);
 	
+	//! Replace statistics of actions by a copy of the statistics of another learning module.
+	void assignStatistics(const LearningModule& inOriginal);
+	//! Add the updates of another learning module since its last merge.
+	void mergeStatistics(const LearningModule& inLearningModule);
+	//! Forget updates since last merge.
+	void clearUpdates();
+	
 	//! Set the system of decision makers in learning module.
 	void setSystem(Core::System::Handle inSystem);
 	//! Set the environment of decision makers in learning module.
@@ -80,20 +85,32 @@ public:
 	//! Set the clock of decision makers in learning module.
 	void setClock(Simulation::Clock::Handle inClock);
 	
+	/*!
+	 * \brief  Return the ID of a specific decision node (the same in the decision makers of all threads).
+	 * \param  inDecisionNode A const reference to the label of decision node.
+	 * \return The ID of decision node.
+	 */
+	unsigned int getDecisionNodeID(const std::string& inDecisionNode) const {
+		schnaps_StackTraceBeginM();
+		return mDecisionMakers[0]->getDecisionNodeID(inDecisionNode);
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::LearningModule::getDecisionNodeID(const std::string&) const");
+	}
+	
 	/*!
 	 * \brief  Return the ID of selected action.
-	 * \param  inDecisionNode A const reference to the decision node.
+	 * \param  inDecisionNodeID The ID of decision node.
 	 * \param  ioContext A referene to the simulation context.
 	 * \return The ID of selected action.
 	 */
-	unsigned int getActionID(const std::string& inDecisionNode, Simulation::SimulationContext& ioContext) {
+	unsigned int getActionID(unsigned int inDecisionNodeID, Simulation::SimulationContext& ioContext) {
 		schnaps_StackTraceBeginM();
-		return mDecisionMakers[ioContext.getThreadNb()]->getActionID(inDecisionNode, ioContext.getIndividualHandle());
-		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::LearningModule::getActionID(const std::string&, SCHNAPS::Simulation::SimulationContext&)");
+		return mDecisionMakers[ioContext.getThreadNb()]->getActionID(inDecisionNodeID, ioContext.getIndividualHandle());
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Learning::LearningModule::getActionID(unsigned int, SCHNAPS::Simulation::SimulationContext&)");
 	}
 	
 private:
 	DecisionMaker::Bag mDecisionMakers;
+	Core::Bool::Handle mLog;	//!< A handle indicating if recorded experiences are written to text log files.
 };
 } // end of Learning namespace
 } // end of Plugins namespace
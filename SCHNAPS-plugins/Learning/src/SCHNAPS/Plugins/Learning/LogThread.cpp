@@ -0,0 +1,60 @@
+/*
+ * LogThread.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Learning/Learning.hpp"
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Learning;
+
+/*!
+ * \brief Construct a thread and start writing experiences.
+ * \param inDecisionMaker A handle to the decision maker whose experiences are written.
+ * \param inFileName A const reference to the name of log output file.
+ */
+LogThread::LogThread(DecisionMaker::Handle inDecisionMaker, const std::string& inFileName) :
+	mDecisionMaker(inDecisionMaker),
+	mFileName(inFileName.c_str())
+{
+	run();
+}
+
+/*!
+ * \brief Destructor, waits for the writing to end.
+ */
+LogThread::~LogThread() {
+	wait();
+}
+
+/*!
+ * \brief Write all experiences to log file, one comma-separated line per decision (flushed once, when closed).
+ */
+void LogThread::main() {
+	const ExperienceBuffer& lExperiences = *mDecisionMaker->getExperiences();
+	std::ofstream lOFS(mFileName.c_str());
+	for (unsigned int i = 0; i < lExperiences.size(); i++) {
+		const Choice& lChoice = mDecisionMaker->getChoice(lExperiences[i].mDecisionNodeID);
+		lOFS << lChoice.getLabel() << ",";
+		lOFS << lChoice.getState(lExperiences[i].mStateID) << ",";
+		lOFS << lExperiences[i].mActionID << ",";
+		lOFS << lExperiences[i].mIndividualIndex << "\n";
+	}
+	lOFS.close();
+}
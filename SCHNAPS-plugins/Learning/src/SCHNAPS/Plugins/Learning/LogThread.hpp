@@ -0,0 +1,62 @@
+/*
+ * LogThread.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Learning_LogThread_hpp
+#define SCHNAPS_Plugins_Learning_LogThread_hpp
+
+#include "SCHNAPS/Plugins/Learning/DecisionMaker.hpp"
+
+#include "SCHNAPS/SCHNAPS.hpp"
+#include "PACC/PACC.hpp"
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Learning {
+
+/*!
+ *  \class LogThread SCHNAPS/Plugins/Learning/LogThread.hpp "SCHNAPS/Plugins/Learning/LogThread.hpp"
+ *  \brief Thread for writing the experiences of a decision maker to a text log file in background.
+ *
+ *  The experiences must not be modified before the thread is destroyed (which waits for the writing to end).
+ */
+class LogThread: public Core::Object, public PACC::Threading::Thread {
+public:
+	//! LogThread allocator type.
+	typedef Core::AllocatorT<LogThread, Core::Object::Alloc> Alloc;
+	//! LogThread handle type.
+	typedef Core::PointerT<LogThread, Core::Object::Handle> Handle;
+	//! LogThread bag type.
+	typedef Core::ContainerT<LogThread, Core::Object::Bag> Bag;
+
+	LogThread(DecisionMaker::Handle inDecisionMaker, const std::string& inFileName);
+	~LogThread();
+
+protected:
+	void main();
+
+private:
+	DecisionMaker::Handle mDecisionMaker;	//!< A handle to the decision maker whose experiences are written.
+	std::string mFileName;					//!< The name of log output file.
+};
+} // end of Learning namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Learning_LogThread_hpp */
@@ -27,18 +27,24 @@ using namespace Learning;
 UpdateThread::UpdateThread() :
 	mParallel(NULL),
 	mSequential(NULL),
-	mDecisionMaker(NULL)
+	mDecisionMaker(NULL),
+	mBatch(NULL),
+	mPart(0),
+	mParts(1)
 {
 	run();
 }
 
 UpdateThread::UpdateThread(PACC::Threading::Condition* inParallel,
 							PACC::Threading::Semaphore* inSequential,
-							const std::string& inFileName) :
+							ExperienceBuffer::Handle inExperiences) :
 	mParallel(inParallel),
 	mSequential(inSequential),
-	mFileName(inFileName.c_str()),
-	mDecisionMaker(NULL)
+	mExperiences(inExperiences),
+	mDecisionMaker(NULL),
+	mBatch(NULL),
+	mPart(0),
+	mParts(1)
 {
 	run();
 }
@@ -57,52 +63,35 @@ void UpdateThread::main() {
 
 	do {
 		switch (mPosition) {
-		case eREADANDUPDATE:
+		case eUPDATE:
 		{
-			std::ifstream* mIFS = new std::ifstream(mFileName.c_str(), std::ifstream::in);
-			PACC::Tokenizer lTokenizer(*mIFS);
-			lTokenizer.setDelimiters(",\n", "");
-			
-			std::string lDecisionNode, lState, lActionIndex, lIndividualIndex;
-			unsigned int lActionID, lIndividualID;
-			
+			const ExperienceBuffer& lExperiences = *mExperiences;
 			double lReward;
 			
-			while (lTokenizer.getNextToken(lDecisionNode)) {
-				lTokenizer.getNextToken(lState);
-				lTokenizer.getNextToken(lActionIndex);
-				lTokenizer.getNextToken(lIndividualIndex);
-				
-				lActionID = SCHNAPS::str2uint(lActionIndex);
-				lIndividualID = SCHNAPS::str2uint(lIndividualIndex);
-				
-				lReward = mDecisionMaker->computeReward(lDecisionNode, lState, lActionID, lIndividualID);
-				
-				// store data in log list
-				mLogList.push_back(Log(lDecisionNode, lState, lActionID, lReward));
+			for (unsigned int i = 0; i < lExperiences.size(); i++) {
+				lReward = mDecisionMaker->computeReward(lExperiences[i].mDecisionNodeID, lExperiences[i].mStateID, lExperiences[i].mActionID, lExperiences[i].mIndividualIndex);
 				
-				// update the current decision maker
-				mDecisionMaker->update(lDecisionNode, lState, lActionID, lReward);
+				// update the statistics shared by all decision makers
+				mDecisionMaker->update(lExperiences[i].mDecisionNodeID, lExperiences[i].mStateID, lExperiences[i].mActionID, lReward);
 			}
 			
-			mIFS->close();
-			delete mIFS;
-			
-			mPosition = eUPDATE;
-
 			mParallel->lock();
 			mSequential->post();
 			mParallel->wait();
 			mParallel->unlock();
 			break;
 		}
-		case eUPDATE:
+		case eREWARD:
 		{
-			for (std::list<Log>::const_iterator lIt = mLogList.begin(); lIt != mLogList.end(); lIt++) {
-				// update the current decision maker
-				mDecisionMaker->update(lIt->mDecisionNode, lIt->mState, lIt->mActionID, lIt->mReward);
+			// compute the rewards of own part of each decision node
+			unsigned int lSize, lBegin, lEnd;
+			for (unsigned int i = 0; i + 1 < mBatch->mOffsets.size(); i++) {
+				lSize = mBatch->mOffsets[i + 1] - mBatch->mOffsets[i];
+				lBegin = mBatch->mOffsets[i] + (lSize * mPart) / mParts;
+				lEnd = mBatch->mOffsets[i] + (lSize * (mPart + 1)) / mParts;
+				mDecisionMaker->computeRewards(i, mBatch->mExperiences, lBegin, lEnd, mBatch->mRewards);
 			}
-
+			
 			mParallel->lock();
 			mSequential->post();
 			mParallel->wait();
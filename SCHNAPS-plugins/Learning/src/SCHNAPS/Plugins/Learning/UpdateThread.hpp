@@ -21,10 +21,13 @@
 #ifndef SCHNAPS_Plugins_Learning_UpdateThread_hpp
 #define SCHNAPS_Plugins_Learning_UpdateThread_hpp
 
+#include "SCHNAPS/Plugins/Learning/DecisionMaker.hpp"
+#include "SCHNAPS/Plugins/Learning/ExperienceBuffer.hpp"
+
 #include "SCHNAPS/SCHNAPS.hpp"
 #include "PACC/PACC.hpp"
 
-#include <list>
+#include <vector>
 
 namespace SCHNAPS {
 namespace Plugins {
@@ -32,23 +35,10 @@ namespace Learning {
 
 /*!
  *  \class UpdateThread SCHNAPS/Plugins/Learning/UpdateThread.hpp "SCHNAPS/Plugins/Learning/UpdateThread.hpp"
- *  \brief Thread for updating the knowledge with previous tries and logged data.
+ *  \brief Thread for updating the shared knowledge with the experiences recorded by one decision maker,
+ *         or for computing a part of the rewards of batched experiences.
  */
 class UpdateThread: public Core::Object, public PACC::Threading::Thread {
-	struct Log {
-		std::string mDecisionNode;
-		std::string mState;
-		unsigned int mActionID;
-		double mReward;
-		
-		Log(const std::string& inDecisionNode, const std::string& inState, unsigned int inActionID, double inReward) :
-			mDecisionNode(inDecisionNode.c_str()),
-			mState(inState.c_str()),
-			mActionID(inActionID),
-			mReward(inReward)
-		{}
-	};
-	
 public:
 	//! UpdateThread allocator type.
 	typedef Core::AllocatorT<UpdateThread, Core::Object::Alloc> Alloc;
@@ -58,12 +48,22 @@ public:
 	typedef Core::ContainerT<UpdateThread, Core::Object::Bag> Bag;
 
 	//! The position of threads in the simulation process.
-	enum Position {eREADANDUPDATE, eUPDATE, eEND};
+	enum Position {eUPDATE, eREWARD, eEND};
+	
+	/*!
+	 * \struct Batch SCHNAPS/Plugins/Learning/UpdateThread.hpp "SCHNAPS/Plugins/Learning/UpdateThread.hpp"
+	 * \brief  Experiences of all decision makers grouped by decision node, with their rewards.
+	 */
+	struct Batch {
+		std::vector<const ExperienceBuffer::Experience*> mExperiences;	//!< Experiences, grouped by decision node (in recording order within a decision node).
+		std::vector<unsigned int> mOffsets;		//!< Index of first experience of each decision node (plus the number of experiences).
+		std::vector<double> mRewards;			//!< Rewards of experiences (same indexes).
+	};
 
 	UpdateThread();
 	UpdateThread(PACC::Threading::Condition* inParallel,
 		PACC::Threading::Semaphore* inSequential,
-		const std::string& inFileName);
+		ExperienceBuffer::Handle inExperiences);
 	~UpdateThread();
 
 	/*!
@@ -77,23 +77,27 @@ public:
 	}
 
 	/*!
-	 * \brief Set the position of thread in update process.
-	 * \param inPosition The position of thread in update process.
+	 * \brief Set the part of batch whose rewards are computed by thread.
+	 * \param ioBatch A pointer to the batch.
+	 * \param inPart The index of part computed by thread.
+	 * \param inParts The number of parts (one per thread).
 	 */
-	void setPosition(Position inPosition) {
+	void setBatch(Batch* ioBatch, unsigned int inPart, unsigned int inParts) {
 		schnaps_StackTraceBeginM();
-		mPosition = inPosition;
-		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::UpdateThread::setPosition(SCHNAPS::Plugins::Learning::UpdateThread::Position)");
+		mBatch = ioBatch;
+		mPart = inPart;
+		mParts = inParts;
+		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::UpdateThread::setBatch(SCHNAPS::Plugins::Learning::UpdateThread::Batch*, unsigned int, unsigned int)");
 	}
 
 	/*!
-	 * \brief  Return a reference to the list of logs read by this thread.
-	 * \return A reference to the list of logs read by this thread.
+	 * \brief Set the position of thread in update process.
+	 * \param inPosition The position of thread in update process.
 	 */
-	std::list<Log>& getLogList() {
+	void setPosition(Position inPosition) {
 		schnaps_StackTraceBeginM();
-		return mLogList;
-		schnaps_StackTraceEndM("SCHNAPS::Plugins::Learning::std::list<SCHNAPS::Plugins::Learning::UpdateThread::Log>& SCHNAPS::Plugins::Learning::UpdateThread::getLogList()");
+		mPosition = inPosition;
+		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Learning::UpdateThread::setPosition(SCHNAPS::Plugins::Learning::UpdateThread::Position)");
 	}
 
 	/*!
@@ -113,9 +117,12 @@ private:
 	PACC::Threading::Condition* mParallel;		//!< A pointer to the condition for starting parallel execution.
 	PACC::Threading::Semaphore* mSequential;	//!< A pointer to the semaphore for triggering sequential execution (by main thread).
 
-	std::string mFileName;						//!< The name of log input file from which to update.
-	std::list<Log> mLogList;					//!< The list of logs read by this thread.
+	ExperienceBuffer::Handle mExperiences;		//!< A handle to the experiences from which to update.
 	DecisionMaker::Handle mDecisionMaker;		//!< A handle to the decision maker to update.
+	
+	Batch* mBatch;								//!< A pointer to the batch whose rewards are computed.
+	unsigned int mPart;							//!< The index of part of each decision node computed by thread.
+	unsigned int mParts;						//!< The number of parts of each decision node.
 
 	Position mPosition;							//!< The position of threads in execution.
 };
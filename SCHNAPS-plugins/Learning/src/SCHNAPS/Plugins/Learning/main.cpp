@@ -21,6 +21,8 @@
 #include "SCHNAPS/SCHNAPS.hpp"
 #include "SCHNAPS/Plugins/Learning/Learning.hpp"
 #include "PACC/Util.hpp"
+
+#include <algorithm>
  
 #ifdef SCHNAPS_IS_UNIX
 #include <sys/stat.h>
@@ -34,6 +36,25 @@ using namespace SCHNAPS;
 using namespace Plugins;
 using namespace Learning;
 
+/*!
+ * \brief Add the learning parameters (with default values) to the system of a simulator.
+ * \param ioSimulator A reference to the simulator.
+ */
+void insertLearningParameters(Simulation::Simulator& ioSimulator) {
+	schnaps_StackTraceBeginM();
+	Core::Parameters& lParameters = ioSimulator.getSystem().getParameters();
+	lParameters.insertParameter("learning.episodes", new Core::UInt(50));
+	lParameters.insertParameter("learning.evaluate", new Core::Bool(false));
+	lParameters.insertParameter("learning.folders", new Core::Bool(false));
+	lParameters.insertParameter("learning.geas.alpha", new Core::Double(1));
+	lParameters.insertParameter("learning.learn", new Core::Bool(true));
+	lParameters.insertParameter("learning.log", new Core::Bool(false));
+	lParameters.insertParameter("learning.merge", new Core::UInt(1));
+	lParameters.insertParameter("learning.parallel", new Core::UInt(1));
+	lParameters.insertParameter("learning.seed", new Core::ULong(0));
+	schnaps_StackTraceEndM("void insertLearningParameters(SCHNAPS::Simulation::Simulator&)");
+}
+
 int main(int argc, char* argv[]) {
 	try{
 		int lOpt;
@@ -96,11 +117,7 @@ int main(int argc, char* argv[]) {
 		Simulation::Simulator lSimulator;
 		
 		// add learning parameters (with default values)
-		lSimulator.getSystem().getParameters().insertParameter("learning.episodes", new Core::UInt(50));
-		lSimulator.getSystem().getParameters().insertParameter("learning.evaluate", new Core::Bool(false));
-		lSimulator.getSystem().getParameters().insertParameter("learning.folders", new Core::Bool(false));
-		lSimulator.getSystem().getParameters().insertParameter("learning.geas.alpha", new Core::Double(1));
-		lSimulator.getSystem().getParameters().insertParameter("learning.learn", new Core::Bool(true));
+		insertLearningParameters(lSimulator);
 
 		// set current working directy
 		if (lDirectory.empty() == false) {
@@ -115,7 +132,6 @@ int main(int argc, char* argv[]) {
 		PACC::XML::Document *lDocument = new PACC::XML::Document();
 		lDocument->parse(lConfigurationFile);
 		lSimulator.read(lDocument->getFirstDataTag());
-		delete lDocument;
 
 		// command-line parameters override configuration file.
 		if (lParameters.empty() == false) {
@@ -135,6 +151,38 @@ int main(int argc, char* argv[]) {
 		unsigned int lEpisodes = Core::castHandleT<Core::UInt>(lSimulator.getSystem().getParameters().getParameterHandle("learning.episodes"))->getValue();
 		bool lEvaluate = Core::castHandleT<Core::Bool>(lSimulator.getSystem().getParameters().getParameterHandle("learning.evaluate"))->getValue();
 		bool lFolders = Core::castHandleT<Core::Bool>(lSimulator.getSystem().getParameters().getParameterHandle("learning.folders"))->getValue();
+		unsigned int lMerge = Core::castHandleT<Core::UInt>(lSimulator.getSystem().getParameters().getParameterHandle("learning.merge"))->getValue();
+		unsigned int lParallel = Core::castHandleT<Core::UInt>(lSimulator.getSystem().getParameters().getParameterHandle("learning.parallel"))->getValue();
+		unsigned long lSeed = Core::castHandleT<Core::ULong>(lSimulator.getSystem().getParameters().getParameterHandle("learning.seed"))->getValue();
+		
+		if (lMerge == 0) {
+			lMerge = 1;
+		}
+		
+		// asynchronous mode: one more simulator per concurrent episode, read from the same parsed document
+		// (the XML is parsed once, but each simulator builds its own definitions from it: primitives bind
+		// parameters and components of the system they are read with, such as accumulators, so process
+		// trees cannot be shared across simulators the way they are shared across threads of one simulator)
+		Simulation::Simulator::Bag lSimulators;
+		std::vector<LearningModule::Handle> lLearningModules;
+		if (lParallel > 1) {
+			lLearningModules.push_back(lLearningModule);
+			for (unsigned int i = 1; i < lParallel; i++) {
+				Simulation::Simulator::Handle lSimulator_i = new Simulation::Simulator();
+				insertLearningParameters(*lSimulator_i);
+				lSimulator_i->read(lDocument->getFirstDataTag());
+				if (lParameters.empty() == false) {
+					lSimulator_i->configure(lParameters);
+				}
+				
+				lLearningModules.push_back(Core::castHandleT<LearningModule>(lSimulator_i->getSystem().getComponentHandle("Learning_LearningModule")));
+				lLearningModules.back()->setSystem(lSimulator_i->getSystemHandle());
+				lLearningModules.back()->setEnvironment(lSimulator_i->getEnvironmentHandle());
+				lLearningModules.back()->setClock(lSimulator_i->getClockHandle());
+				lSimulators.push_back(lSimulator_i);
+			}
+		}
+		delete lDocument;
 		
 		// backup learning configuration
 		std::string lLearningConf = lSimulator.getConfiguration();
@@ -153,14 +201,100 @@ int main(int argc, char* argv[]) {
 		
 		fflush(stdout);
 		
-		// learn	
-		for (unsigned int i = 0; i < lEpisodes; i++) {
+		// learn (asynchronous mode)
+		// in each round, every simulator runs lMerge episodes concurrently, then statistics are merged
+		for (unsigned int i = 0; lParallel > 1 && i < lEpisodes; i += lParallel * lMerge) {
+#ifdef SCHNAPS_FULL_DEBUG
+			std::cout << "Episodes " << i << " to " << std::min(i + lParallel * lMerge, lEpisodes) - 1 << "\n";
+#endif
+			EpisodeThread::Bag lEpisodeThreads;
+			std::vector<unsigned int> lEpisodesThread;
+			std::vector<std::string> lErrors(lParallel);
+			for (unsigned int j = 0; j < lParallel; j++) {
+				lEpisodesThread.clear();
+				for (unsigned int k = i + j * lMerge; k < i + (j + 1) * lMerge && k < lEpisodes; k++) {
+					lEpisodesThread.push_back(k);
+				}
+				if (lEpisodesThread.empty() == false) {
+					lEpisodeThreads.push_back(new EpisodeThread(j == 0 ? lSimulator : *lSimulators[j - 1], lScenario, lInputLearning, lLearningConf, lPrintPrefix_Basic, lFolders, lSeed, lEpisodesThread, lErrors[j]));
+				}
+			}
+			// wait for all episodes of round
+			lEpisodeThreads.clear();
+			
+			// report errors of episodes, once all threads are joined
+			for (unsigned int j = 0; j < lParallel; j++) {
+				if (lErrors[j].empty() == false) {
+					throw schnaps_RunTimeExceptionM(lErrors[j]);
+				}
+			}
+			
+			// merge statistics in simulator order (deterministic), then share them with all simulators
+			for (unsigned int j = 1; j < lParallel; j++) {
+				lLearningModules[0]->mergeStatistics(*lLearningModules[j]);
+			}
+			for (unsigned int j = 1; j < lParallel; j++) {
+				lLearningModules[j]->assignStatistics(*lLearningModules[0]);
+			}
+			lLearningModules[0]->clearUpdates();
+			
+			// last episode of round
+			unsigned int lLast = std::min(i + lParallel * lMerge, lEpisodes) - 1;
+			
+			if (lPrintConf) {
+				// print configuration file (with merged statistics)
+				lSS.str("");
+				if (lFolders) {
+					lSS << lPrintPrefix_Basic << lLast << "/configuration.xml";
+				} else {
+					lSS << lPrintPrefix_Basic << lLast << "_configuration.xml";
+				}
+				lOFS.open(lSS.str().c_str());
+				lOStreamer = new PACC::XML::Streamer(lOFS);
+				lSimulator.write(*lOStreamer);
+				lOFS.close();
+				delete lOStreamer;
+			}
+			
+			if (lEvaluate) {
+#ifdef SCHNAPS_FULL_DEBUG
+				std::cout << "Evaluating\n";
+#endif
+				// evaluate the current performance
+				// reset randomizers to configuration values
+				lSimulator.resetRandomizer();
+				lSimulator.getPopulationManager().getGenerator().resetRandomizer();
+				
+				// simulate
+				lSS.str("");
+				if (lFolders) {
+					lSS << "print.prefix=" << lPrintPrefix_Basic << lLast << "/";
+				} else {
+					lSS << "print.prefix=" << lPrintPrefix_Basic << lLast << "_";
+				}
+				lSS << ",print.input=false,print.output=true,print.log=false,learning.learn=false";
+				lSimulator.configure(lSS.str().c_str());
+				lSimulator.getPopulationManager().clear();
+				lSimulator.getPopulationManager().readStr(lInputEvaluation);
+				lSimulator.simulate(lScenario);
+			}
+			
+			fflush(stdout);
+		}
+		
+		// learn (sequential mode)
+		for (unsigned int i = 0; lParallel <= 1 && i < lEpisodes; i++) {
 #ifdef SCHNAPS_FULL_DEBUG
 			std::cout << "Episode " << i << "\n";
 #endif
-			// reset randomizers to random values
-			lSimulator.clearRandomizer();
-			lSimulator.getPopulationManager().getGenerator().clearRandomizer();
+			// reset randomizers to random values (or to values of episode i if seeded)
+			if (lSeed == 0) {
+				lSimulator.clearRandomizer();
+				lSimulator.getPopulationManager().getGenerator().clearRandomizer();
+			} else {
+				lSimulator.seedRandomizer(lSeed + 2 * i);
+				lSimulator.getPopulationManager().getGenerator().seedRandomizer(lSeed + 2 * i + 1);
+			}
 			
 			// reset configuration for learning
 			lSimulator.configure(lLearningConf);
@@ -187,18 +321,15 @@ int main(int argc, char* argv[]) {
 			}
 			lSimulator.configure(lSS.str().c_str());
 			
-			// open learning log files
-			lSS.str("");
-			lSS << lPrintPrefix_Basic << "LearningLog";
-			lLearningModule->open(lSS.str());
+			// clear experiences of previous episode
+			lLearningModule->clear();
 			
 			// run simulation (for learning)
 			lSimulator.simulate(lScenario);
 			
-			// close log files
-			lLearningModule->close();
-			
-			// update state-action values
+			// update state-action values (and write learning log files if required)
+			lSS.str("");
+			lSS << lPrintPrefix_Basic << "LearningLog";
 			lLearningModule->update(lSS.str());
 			
 			if (lPrintConf) {
@@ -0,0 +1,223 @@
+/*
+ * Accumulator.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Plugins/Meds/Meds.hpp"
+
+using namespace SCHNAPS;
+using namespace Plugins;
+using namespace Meds;
+
+/*!
+ * \brief Default constructor.
+ */
+Accumulator::Accumulator() :
+	mDeclared(false),
+	mSlots(1)
+{}
+
+/*!
+ * \brief Construct an accumulator as a copy of an original.
+ * \param inOriginal A const reference to the original accumulator.
+ *
+ * Categories are copied, but cached discount divisors and subtotals are not.
+ */
+Accumulator::Accumulator(const Accumulator& inOriginal) :
+	mDeclared(inOriginal.mDeclared),
+	mCategories(inOriginal.mCategories),
+	mCategoryIDs(inOriginal.mCategoryIDs)
+{
+	resize(inOriginal.mSlots.size());
+}
+
+/*!
+ * \brief Read object from XML using system.
+ * \param inIter XML iterator of input document.
+ * \param ioSystem A reference to the system.
+ * \throw SCHNAPS::Core::IOException if a wrong tag is encountered.
+ * \throw SCHNAPS::Core::IOException if a category label attribute is missing.
+ */
+void Accumulator::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSystem) {
+	schnaps_StackTraceBeginM();
+	if (inIter->getType() != PACC::XML::eData) {
+		throw schnaps_IOExceptionNodeM(*inIter, "tag expected!");
+	}
+	if (inIter->getValue() != getName()) {
+		std::ostringstream lOSS;
+		lOSS << "tag <" << getName() << "> expected, but ";
+		lOSS << "got tag <" << inIter->getValue() << "> instead!";
+		throw schnaps_IOExceptionNodeM(*inIter, lOSS.str());
+	}
+
+	init(ioSystem);
+	mDeclared = true;
+
+	// categories declared in advance (others are registered by primitives)
+	for (PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; lChild++) {
+		if (lChild->getType() == PACC::XML::eData) {
+			if (lChild->getValue() != "Category") {
+				std::ostringstream lOSS;
+				lOSS << "tag <Category> expected, but ";
+				lOSS << "got tag <" << lChild->getValue() << "> instead!";
+				throw schnaps_IOExceptionNodeM(*lChild, lOSS.str());
+			}
+			if (lChild->getAttribute("label").empty()) {
+				throw schnaps_IOExceptionNodeM(*lChild, "label of category expected!");
+			}
+			getCategoryID(lChild->getAttribute("label"));
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
+}
+
+/*!
+ * \brief Write object to XML, only if it was declared in the configuration.
+ * \param ioStreamer XML streamer to output document.
+ * \param inIndent Wether to indent or not.
+ *
+ * An accumulator installed by primitives is installed again when the model is read back.
+ */
+void Accumulator::write(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
+	schnaps_StackTraceBeginM();
+	if (mDeclared) {
+		Core::Component::write(ioStreamer, inIndent);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::write(PACC::XML::Streamer&, bool) const");
+}
+
+/*!
+ * \brief Write object content to XML.
+ * \param ioStreamer XML streamer to output document.
+ * \param inIndent Wether to indent or not.
+ */
+void Accumulator::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mCategories.size(); i++) {
+		ioStreamer.openTag("Category");
+		ioStreamer.insertAttribute("label", mCategories[i]);
+		ioStreamer.insertAttribute("subtotal", getSubtotal(i));
+		ioStreamer.closeTag();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::writeContent(PACC::XML::Streamer&, bool) const");
+}
+
+/*!
+ * \brief Initialize this component.
+ * \param ioSystem A reference to the system.
+ */
+void Accumulator::init(Core::System& ioSystem) {
+	schnaps_StackTraceBeginM();
+	// primitives may run in simulation or generation contexts
+	unsigned int lThreadsSimulator = Core::castObjectT<const Core::UInt&>(ioSystem.getParameters().getParameter("threads.simulator")).getValue();
+	unsigned int lThreadsGenerator = Core::castObjectT<const Core::UInt&>(ioSystem.getParameters().getParameter("threads.generator")).getValue();
+	resize(std::max(lThreadsSimulator, lThreadsGenerator));
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::init(SCHNAPS::Core::System&)");
+}
+
+/*!
+ * \brief Reset this component before a simulation, clearing the subtotals and cached discount divisors.
+ * \param ioSystem A reference to the system.
+ */
+void Accumulator::reset(Core::System& ioSystem) {
+	schnaps_StackTraceBeginM();
+	clearSubtotals();
+	for (unsigned int i = 0; i < mSlots.size(); i++) {
+		mSlots[i].mDiscountDivisors.clear();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::reset(SCHNAPS::Core::System&)");
+}
+
+/*!
+ * \brief  Return a handle to the accumulator of a system, installing one if needed.
+ * \param  ioSystem A reference to the system.
+ * \return A handle to the accumulator.
+ */
+Accumulator::Handle Accumulator::install(Core::System& ioSystem) {
+	schnaps_StackTraceBeginM();
+	if (ioSystem.find("Meds_Accumulator") == ioSystem.end()) {
+		Accumulator::Handle lAccumulator = new Accumulator();
+		lAccumulator->init(ioSystem);
+		ioSystem.addComponent(lAccumulator);
+	}
+	return Core::castHandleT<Accumulator>(ioSystem.getComponentHandle("Meds_Accumulator"));
+	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::Accumulator::Handle SCHNAPS::Plugins::Meds::Accumulator::install(SCHNAPS::Core::System&)");
+}
+
+/*!
+ * \brief  Return the ID of a category, registering it if needed.
+ * \param  inCategory A const reference to the label of category.
+ * \return The ID of category.
+ *
+ * Categories must be registered before simulation, while reading primitives.
+ */
+unsigned int Accumulator::getCategoryID(const std::string& inCategory) {
+	schnaps_StackTraceBeginM();
+	std::map<std::string, unsigned int>::const_iterator lIt = mCategoryIDs.find(inCategory);
+	if (lIt != mCategoryIDs.end()) {
+		return lIt->second;
+	}
+	unsigned int lID = mCategories.size();
+	mCategories.push_back(inCategory);
+	mCategoryIDs[inCategory] = lID;
+	for (unsigned int i = 0; i < mSlots.size(); i++) {
+		mSlots[i].mSubtotals.resize(mCategories.size(), 0);
+	}
+	return lID;
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Plugins::Meds::Accumulator::getCategoryID(const std::string&)");
+}
+
+/*!
+ * \brief  Return the sum of all values accumulated in a category.
+ * \param  inCategoryID The ID of category.
+ * \return The subtotal of category over all threads.
+ */
+double Accumulator::getSubtotal(unsigned int inCategoryID) const {
+	schnaps_StackTraceBeginM();
+	schnaps_UpperBoundCheckAssertM(inCategoryID, mCategories.size()-1);
+	double lSubtotal = 0;
+	for (unsigned int i = 0; i < mSlots.size(); i++) {
+		lSubtotal += mSlots[i].mSubtotals[inCategoryID];
+	}
+	return lSubtotal;
+	schnaps_StackTraceEndM("double SCHNAPS::Plugins::Meds::Accumulator::getSubtotal(unsigned int) const");
+}
+
+/*!
+ * \brief Reset the subtotals of all categories.
+ */
+void Accumulator::clearSubtotals() {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mSlots.size(); i++) {
+		mSlots[i].mSubtotals.assign(mCategories.size(), 0);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::clearSubtotals()");
+}
+
+/*!
+ * \brief Resize the thread slots.
+ * \param inThreads The number of threads.
+ */
+void Accumulator::resize(unsigned int inThreads) {
+	schnaps_StackTraceBeginM();
+	mSlots.resize(inThreads);
+	for (unsigned int i = 0; i < mSlots.size(); i++) {
+		mSlots[i].mSubtotals.resize(mCategories.size(), 0);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::resize(unsigned int)");
+}
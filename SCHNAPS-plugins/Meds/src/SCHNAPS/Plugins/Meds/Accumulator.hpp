@@ -0,0 +1,172 @@
+/*
+ * Accumulator.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Plugins_Meds_Accumulator_hpp
+#define SCHNAPS_Plugins_Meds_Accumulator_hpp
+
+#include "SCHNAPS/SCHNAPS.hpp"
+
+#include "PACC/XML.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace SCHNAPS {
+namespace Plugins {
+namespace Meds {
+
+/*!
+ *  \class Accumulator SCHNAPS/Plugins/Meds/Accumulator.hpp "SCHNAPS/Plugins/Meds/Accumulator.hpp"
+ *  \brief System component accumulating discounted costs and QALYs.
+ *
+ *  Discount divisors are cached per (rate, time) for each thread, so that std::pow is evaluated
+ *  once per tick instead of once per call; the cache is cleared before each simulation. Totals are
+ *  added in place to the values held by individual states, and every addition is also summed by
+ *  category. Thread slots are mutable, so that const primitives can accumulate.
+ */
+class Accumulator: public Core::Component {
+public:
+	//! Accumulator allocator type.
+	typedef Core::AllocatorT<Accumulator, Core::Component::Alloc> Alloc;
+	//! Accumulator handle type.
+	typedef Core::PointerT<Accumulator, Core::Component::Handle> Handle;
+	//! Accumulator bag type.
+	typedef Core::ContainerT<Accumulator, Core::Component::Bag> Bag;
+
+	Accumulator();
+	Accumulator(const Accumulator& inOriginal);
+	virtual ~Accumulator() {}
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("Meds_Accumulator");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Plugins::Meds::Accumulator::getName() const");
+	}
+
+	//! Read object from XML using system.
+	virtual void readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSystem);
+	//! Write object to XML, only if it was declared in the configuration.
+	virtual void write(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
+	//! Write content of object to XML.
+	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
+
+	//! Initialize the component.
+	virtual void init(Core::System& ioSystem);
+	//! Reset the component before a simulation.
+	virtual void reset(Core::System& ioSystem);
+
+	//! Return a handle to the accumulator of a system, installing one if needed.
+	static Handle install(Core::System& ioSystem);
+
+	//! Return the ID of a category, registering it if needed.
+	unsigned int getCategoryID(const std::string& inCategory);
+	//! Return the sum of all values accumulated in a category.
+	double getSubtotal(unsigned int inCategoryID) const;
+	//! Reset the subtotals of all categories.
+	void clearSubtotals();
+
+	/*!
+	 * \brief  Return the discount divisor (1+rate)^time.
+	 * \param  inRate The discount rate.
+	 * \param  inTime The time (in years).
+	 * \param  inThreadNb The number of calling thread.
+	 * \return The discount divisor.
+	 */
+	double getDiscountDivisor(double inRate, double inTime, unsigned int inThreadNb) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inThreadNb, mSlots.size()-1);
+		std::map<std::pair<double, double>, double>& lDivisors = mSlots[inThreadNb].mDiscountDivisors;
+		std::pair<double, double> lKey(inRate, inTime);
+		std::map<std::pair<double, double>, double>::iterator lIt = lDivisors.lower_bound(lKey);
+		if (lIt == lDivisors.end() || lDivisors.key_comp()(lKey, lIt->first)) {
+			lIt = lDivisors.insert(lIt, std::make_pair(lKey, std::pow(inRate + 1, inTime)));
+		}
+		return lIt->second;
+		schnaps_StackTraceEndM("double SCHNAPS::Plugins::Meds::Accumulator::getDiscountDivisor(double, double, unsigned int) const");
+	}
+
+	/*!
+	 * \brief Add a value to a variable of a state and to the subtotal of a category.
+	 * \param ioState A reference to the state.
+	 * \param inLabel A const reference to the label of the variable.
+	 * \param inValue The value to add.
+	 * \param inCategoryID The ID of category.
+	 * \param inThreadNb The number of calling thread.
+	 * \return The new value of the variable.
+	 */
+	double accumulate(Simulation::State& ioState, const std::string& inLabel, double inValue, unsigned int inCategoryID, unsigned int inThreadNb) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inThreadNb, mSlots.size()-1);
+		Core::AnyType::Handle lVariable = ioState.getVariableHandle(inLabel);
+		Core::Double& lTotal = Core::castObjectT<Core::Double&>(*lVariable);
+		lTotal.setValue(lTotal.getValue() + inValue);
+		mSlots[inThreadNb].mSubtotals[inCategoryID] += inValue;
+		return lTotal.getValue();
+		schnaps_StackTraceEndM("double SCHNAPS::Plugins::Meds::Accumulator::accumulate(SCHNAPS::Simulation::State&, const std::string&, double, unsigned int, unsigned int) const");
+	}
+
+	/*!
+	 * \brief Replace the value of a variable of a state, counting the difference in the subtotal of a category.
+	 * \param ioState A reference to the state.
+	 * \param inLabel A const reference to the label of the variable.
+	 * \param inValue The new value.
+	 * \param inCategoryID The ID of category.
+	 * \param inThreadNb The number of calling thread.
+	 */
+	void assign(Simulation::State& ioState, const std::string& inLabel, double inValue, unsigned int inCategoryID, unsigned int inThreadNb) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inThreadNb, mSlots.size()-1);
+		Core::AnyType::Handle lVariable = ioState.getVariableHandle(inLabel);
+		Core::Double& lTotal = Core::castObjectT<Core::Double&>(*lVariable);
+		mSlots[inThreadNb].mSubtotals[inCategoryID] += inValue - lTotal.getValue();
+		lTotal.setValue(inValue);
+		schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Accumulator::assign(SCHNAPS::Simulation::State&, const std::string&, double, unsigned int, unsigned int) const");
+	}
+
+private:
+	/*!
+	 * \struct Slot SCHNAPS/Plugins/Meds/Accumulator.hpp "SCHNAPS/Plugins/Meds/Accumulator.hpp"
+	 * \brief  Data owned by a single thread.
+	 */
+	struct Slot {
+		std::map<std::pair<double, double>, double> mDiscountDivisors;	//!< Cached discount divisors, per (rate, time).
+		std::vector<double> mSubtotals;									//!< Subtotals, per category ID.
+	};
+
+	//! Resize the thread slots.
+	void resize(unsigned int inThreads);
+
+	bool mDeclared;										//!< True if the accumulator was declared in the configuration.
+	mutable std::vector<Slot> mSlots;					//!< Thread slots, per thread number.
+	std::vector<std::string> mCategories;				//!< Category labels, per category ID.
+	std::map<std::string, unsigned int> mCategoryIDs;	//!< Map of category labels to IDs.
+};
+} // end of Meds namespace
+} // end of Plugins namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Plugins_Meds_Accumulator_hpp */
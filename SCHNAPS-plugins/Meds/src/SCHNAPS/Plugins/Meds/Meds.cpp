@@ -23,6 +23,7 @@
 
 SCHNAPS_Plugin_BeginDefinitionM("Meds", "2.0.0");
 
+SCHNAPS_Plugin_AddAllocM("Meds_Accumulator", SCHNAPS::Plugins::Meds::Accumulator::Alloc);
 SCHNAPS_Plugin_AddAllocM("Meds_Event", SCHNAPS::Plugins::Meds::Event::Alloc);
 SCHNAPS_Plugin_AddAllocM("Meds_PreventionCampaign", SCHNAPS::Plugins::Meds::PreventionCampaign::Alloc);
 SCHNAPS_Plugin_AddAllocM("Meds_SetBaseQaly", SCHNAPS::Plugins::Meds::SetBaseQaly::Alloc);
@@ -21,6 +21,7 @@
 #ifndef Meds_hpp
 #define Meds_hpp
 
+#include "SCHNAPS/Plugins/Meds/Accumulator.hpp"
 #include "SCHNAPS/Plugins/Meds/Event.hpp"
 #include "SCHNAPS/Plugins/Meds/PreventionCampaign.hpp"
 #include "SCHNAPS/Plugins/Meds/SetBaseQaly.hpp"
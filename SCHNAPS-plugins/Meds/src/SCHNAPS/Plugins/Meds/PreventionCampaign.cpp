@@ -33,7 +33,10 @@ PreventionCampaign::PreventionCampaign() :
 	mCost_Ref(""),
 	mCost(NULL),
 	mDiscountRate_Ref(""),
-	mDiscountRate(NULL)
+	mDiscountRate(NULL),
+	mCategory(""),
+	mCategoryID(0),
+	mAccumulator(NULL)
 {}
 
 /*!
@@ -44,7 +47,10 @@ PreventionCampaign::PreventionCampaign(const PreventionCampaign& inOriginal) :
 	Primitive(0),
 	mOutCost_Ref(inOriginal.mOutCost_Ref.c_str()),
 	mCost_Ref(inOriginal.mCost_Ref.c_str()),
-	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str())
+	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str()),
+	mCategory(inOriginal.mCategory.c_str()),
+	mCategoryID(inOriginal.mCategoryID),
+	mAccumulator(inOriginal.mAccumulator)
 {
 	switch (mCost_Ref[0]) {
 		case '@':
@@ -133,6 +139,10 @@ PreventionCampaign& PreventionCampaign::operator=(const PreventionCampaign& inOr
 			break;
 	}
 
+	mCategory.assign(inOriginal.mCategory.c_str());
+	mCategoryID = inOriginal.mCategoryID;
+	mAccumulator = inOriginal.mAccumulator;
+
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::PreventionCampaign& SCHNAPS::Plugins::Meds::PreventionCampaign::operator=(const SCHNAPS::Plugins::Meds::PreventionCampaign&)");
 }
@@ -216,6 +226,11 @@ void PreventionCampaign::readWithSystem(PACC::XML::ConstIterator inIter, Core::S
 			mDiscountRate = new Core::Double(SCHNAPS::str2dbl(mDiscountRate_Ref));
 			break;
 		}
+
+	// retrieve category of accumulated costs (by default, the output cost destination)
+	mCategory.assign(inIter->getAttribute("inCategory"));
+	mAccumulator = Accumulator::install(ioSystem);
+	mCategoryID = mAccumulator->getCategoryID(mCategory.empty() ? mOutCost_Ref.substr(1) : mCategory);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::PreventionCampaign::readWithSystem(PACC::XML::ConstIterator, Core::System&)");
 }
 
@@ -229,6 +244,9 @@ void PreventionCampaign::writeContent(PACC::XML::Streamer& ioStreamer, bool inIn
 	ioStreamer.insertAttribute("outCost", mOutCost_Ref);
 	ioStreamer.insertAttribute("inCost", mCost_Ref);
 	ioStreamer.insertAttribute("inDiscountRate", mDiscountRate_Ref);
+	if (!mCategory.empty()) {
+		ioStreamer.insertAttribute("inCategory", mCategory);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::PreventionCampaign::writeContent(PACC::XML::Streamer&, bool) const");
 }
 
@@ -242,7 +260,7 @@ Core::AnyType::Handle PreventionCampaign::execute(unsigned int inIndex, Core::Ex
 	schnaps_StackTraceBeginM();
 	Simulation::SimulationContext& lContext = Core::castObjectT<Simulation::SimulationContext&>(ioContext);
 	double lTime = lContext.getClock().getValue();
-	double lCost, lCurrentCost, lDiscountRate;
+	double lCost, lDiscountRate;
 
 	switch (mCost_Ref[0]) {
 		case '@':
@@ -282,9 +300,8 @@ Core::AnyType::Handle PreventionCampaign::execute(unsigned int inIndex, Core::Ex
 			break;
 	}
 	
-	lCost = lCost/std::pow(lDiscountRate + 1, lTime);
-	lCurrentCost = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutCost_Ref.substr(1))).getValue();
-	lContext.getIndividual().getState().setVariable(mOutCost_Ref.substr(1), new Core::Double(lCurrentCost + lCost));
+	lCost = lCost/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb());
+	mAccumulator->accumulate(lContext.getIndividual().getState(), mOutCost_Ref.substr(1), lCost, mCategoryID, lContext.getThreadNb());
 	return NULL;
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Plugins::Meds::PreventionCampaign::execute(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
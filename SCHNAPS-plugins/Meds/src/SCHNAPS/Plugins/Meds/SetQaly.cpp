@@ -31,14 +31,20 @@ SetQaly::SetQaly() :
 	mQaly_Ref(""),
 	mQaly(NULL),
 	mDiscountRate_Ref(""),
-	mDiscountRate(NULL)
+	mDiscountRate(NULL),
+	mCategory(""),
+	mCategoryID(0),
+	mAccumulator(NULL)
 {}
 
 SetQaly::SetQaly(const SetQaly& inOriginal) :
 	mOutQaly_Ref(inOriginal.mOutQaly_Ref.c_str()),
 	mOldQaly_Ref(inOriginal.mOldQaly_Ref.c_str()),
 	mQaly_Ref(inOriginal.mQaly_Ref.c_str()),
-	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str())
+	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str()),
+	mCategory(inOriginal.mCategory.c_str()),
+	mCategoryID(inOriginal.mCategoryID),
+	mAccumulator(inOriginal.mAccumulator)
 {
 	
 	switch (mQaly_Ref[0]) {
@@ -130,6 +136,10 @@ SetQaly& SetQaly::operator=(const SetQaly& inOriginal) {
 			break;
 	}
 
+	mCategory.assign(inOriginal.mCategory.c_str());
+	mCategoryID = inOriginal.mCategoryID;
+	mAccumulator = inOriginal.mAccumulator;
+
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::SetQaly& SCHNAPS::Plugins::Meds::SetQaly::operator=(const SCHNAPS::Plugins::Meds::SetQaly&)");
 }
@@ -223,6 +233,11 @@ void SetQaly::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSy
 			break;
 		}
 
+
+	// retrieve category of accumulated QALYs (by default, the output qaly destination)
+	mCategory.assign(inIter->getAttribute("inCategory"));
+	mAccumulator = Accumulator::install(ioSystem);
+	mCategoryID = mAccumulator->getCategoryID(mCategory.empty() ? mOutQaly_Ref.substr(1) : mCategory);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::SetQaly::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -237,6 +252,9 @@ void SetQaly::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 	ioStreamer.insertAttribute("inOldQaly", mOldQaly_Ref);
 	ioStreamer.insertAttribute("inQaly", mQaly_Ref);
 	ioStreamer.insertAttribute("inDiscountRate", mDiscountRate_Ref);
+	if (!mCategory.empty()) {
+		ioStreamer.insertAttribute("inCategory", mCategory);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::SetQaly::writeContent(PACC::XML::Streamer&, bool) const");
 }
 
@@ -293,9 +311,9 @@ Core::AnyType::Handle SetQaly::execute(unsigned int inIndex, Core::ExecutionCont
 	lTotalQaly = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutQaly_Ref.substr(1))).getValue();
 	lOldQaly = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOldQaly_Ref.substr(1))).getValue();
 
-	if(lOldQaly+lQaly/std::pow(lDiscountRate + 1, lTime) < lTotalQaly) {
-		
-		lContext.getIndividual().getState().setVariable(mOutQaly_Ref.substr(1), new Core::Double(lOldQaly+lQaly/std::pow(lDiscountRate + 1, lTime)));
+	lQaly = lOldQaly+lQaly/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb());
+	if(lQaly < lTotalQaly) {
+		mAccumulator->assign(lContext.getIndividual().getState(), mOutQaly_Ref.substr(1), lQaly, mCategoryID, lContext.getThreadNb());
 	}
 	
 	return NULL;
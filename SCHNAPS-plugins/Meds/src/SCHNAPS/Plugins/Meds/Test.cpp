@@ -41,7 +41,10 @@ Test::Test() :
 	mCost(NULL),
 	mDiscountRate_Ref(""),
 	mDiscountRate(NULL),
-	mState_Ref("")
+	mState_Ref(""),
+	mCategory(""),
+	mCategoryID(0),
+	mAccumulator(NULL)
 {}
 
 /*!
@@ -57,7 +60,10 @@ Test::Test(const Test& inOriginal) :
 	mSpecificity_Ref(inOriginal.mSpecificity_Ref.c_str()),
 	mCost_Ref(inOriginal.mCost_Ref.c_str()),
 	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str()),
-	mState_Ref(inOriginal.mState_Ref.c_str())
+	mState_Ref(inOriginal.mState_Ref.c_str()),
+	mCategory(inOriginal.mCategory.c_str()),
+	mCategoryID(inOriginal.mCategoryID),
+	mAccumulator(inOriginal.mAccumulator)
 {
 	switch (mCompliance_Ref[0]) {
 		case '@':
@@ -265,6 +271,10 @@ Test& Test::operator=(const Test& inOriginal) {
 			break;
 	}
 
+	mCategory.assign(inOriginal.mCategory.c_str());
+	mCategoryID = inOriginal.mCategoryID;
+	mAccumulator = inOriginal.mAccumulator;
+
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::Test& SCHNAPS::Plugins::Meds::Test::operator=(const SCHNAPS::Plugins::Meds::Test&)");
 }
@@ -440,6 +450,11 @@ void Test::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& ioSyste
 	if (mState_Ref[0] != '@' && mState_Ref[0] != '%') {
 		throw schnaps_RunTimeExceptionM("The primitive is undefined for the specific state source.");
 	}
+
+	// retrieve category of accumulated costs (by default, the output cost destination)
+	mCategory.assign(inIter->getAttribute("inCategory"));
+	mAccumulator = Accumulator::install(ioSystem);
+	mCategoryID = mAccumulator->getCategoryID(mCategory.empty() ? mOutCost_Ref.substr(1) : mCategory);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Test::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -458,6 +473,9 @@ void Test::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
 	ioStreamer.insertAttribute("inCost", mCost_Ref);
 	ioStreamer.insertAttribute("inDiscountRate", mDiscountRate_Ref);
 	ioStreamer.insertAttribute("inState", mState_Ref);
+	if (!mCategory.empty()) {
+		ioStreamer.insertAttribute("inCategory", mCategory);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Test::writeContent(PACC::XML::Streamer&, bool) const");
 }
 
@@ -494,7 +512,7 @@ Core::AnyType::Handle Test::execute(unsigned int inIndex, Core::ExecutionContext
 	if (ioContext.getRandomizer().rollUniform() <= lCompliance) {
 		// individual is compliant
 		double lTime = lContext.getClock().getValue(SCHNAPS::Simulation::Clock::eYear);
-		double lCost, lCurrentCost, lDiscountRate;
+		double lCost, lDiscountRate;
 
 		switch (mCost_Ref[0]) {
 			case '@':
@@ -534,9 +552,8 @@ Core::AnyType::Handle Test::execute(unsigned int inIndex, Core::ExecutionContext
 		}
 		
 		// add test cost
-		lCost = lCost/std::pow(lDiscountRate + 1, lTime);
-		lCurrentCost = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutCost_Ref.substr(1))).getValue();
-		lContext.getIndividual().getState().setVariable(mOutCost_Ref.substr(1), new Core::Double(lCurrentCost + lCost));
+		lCost = lCost/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb());
+		mAccumulator->accumulate(lContext.getIndividual().getState(), mOutCost_Ref.substr(1), lCost, mCategoryID, lContext.getThreadNb());
 		
 		// test individual
 		bool lState = Core::castObjectT<const Core::Bool&>(lContext.getIndividual().getState().getVariable(mState_Ref.substr(1))).getValue();
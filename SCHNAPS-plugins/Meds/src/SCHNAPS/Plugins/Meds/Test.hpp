@@ -22,6 +22,7 @@
 #define SCHNAPS_Plugins_Meds_Test_hpp
 
 #include "SCHNAPS/SCHNAPS.hpp"
+#include "SCHNAPS/Plugins/Meds/Accumulator.hpp"
 
 #include "PACC/XML.hpp"
 
@@ -86,6 +87,9 @@ private:
 	std::string mDiscountRate_Ref;		//!< Reference to the discount rate.
 	Core::Double::Handle mDiscountRate;	//!< A handle to the discount rate value.
 	std::string mState_Ref;				//!< Reference to the actual state of individual.
+	std::string mCategory;				//!< Category of accumulated costs (empty for the output cost destination).
+	unsigned int mCategoryID;			//!< The ID of category in accumulator.
+	Accumulator::Handle mAccumulator;	//!< A handle to the accumulator of system.
 };
 } // end of Meds namespace
 } // end of Plugins namespace
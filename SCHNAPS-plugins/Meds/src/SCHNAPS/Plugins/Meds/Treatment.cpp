@@ -34,7 +34,10 @@ Treatment::Treatment() :
 	mCost(NULL),
 	mDiscountRate_Ref(""),
 	mDiscountRate(NULL),
-	mChargeNonCompliant(true)
+	mChargeNonCompliant(true),
+	mCategory(""),
+	mCategoryID(0),
+	mAccumulator(NULL)
 {}
 
 Treatment::Treatment(const Treatment& inOriginal) :
@@ -43,7 +46,10 @@ Treatment::Treatment(const Treatment& inOriginal) :
 	mCompliance_Ref(inOriginal.mCompliance_Ref.c_str()),
 	mCost_Ref(inOriginal.mCost_Ref.c_str()),
 	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str()),
-	mChargeNonCompliant(inOriginal.mChargeNonCompliant)
+	mChargeNonCompliant(inOriginal.mChargeNonCompliant),
+	mCategory(inOriginal.mCategory.c_str()),
+	mCategoryID(inOriginal.mCategoryID),
+	mAccumulator(inOriginal.mAccumulator)
 {
 	switch (mCompliance_Ref[0]) {
 		case '@':
@@ -173,6 +179,10 @@ Treatment& Treatment::operator=(const Treatment& inOriginal) {
 			break;
 	}
 
+	mCategory.assign(inOriginal.mCategory.c_str());
+	mCategoryID = inOriginal.mCategoryID;
+	mAccumulator = inOriginal.mAccumulator;
+
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::Treatment& SCHNAPS::Plugins::Meds::Treatment::operator=(const SCHNAPS::Plugins::Meds::Treatment&)");
 }
@@ -301,6 +311,11 @@ void Treatment::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& io
 	} else {
 		throw schnaps_IOExceptionNodeM(*inIter, "unknown value for charge non-compliant flag!");
 	}
+
+	// retrieve category of accumulated costs (by default, the output cost destination)
+	mCategory.assign(inIter->getAttribute("inCategory"));
+	mAccumulator = Accumulator::install(ioSystem);
+	mCategoryID = mAccumulator->getCategoryID(mCategory.empty() ? mOutCost_Ref.substr(1) : mCategory);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Treatment::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -321,6 +336,9 @@ void Treatment::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) con
 	} else {
 		ioStreamer.insertAttribute("inChargeNonCompliante", "false");
 	}
+	if (!mCategory.empty()) {
+		ioStreamer.insertAttribute("inCategory", mCategory);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::Treatment::writeContent(PACC::XML::Streamer&, bool) const");
 }
 
@@ -357,7 +375,7 @@ Core::AnyType::Handle Treatment::execute(unsigned int inIndex, Core::ExecutionCo
 	if (ioContext.getRandomizer().rollUniform() <= lCompliance) {
 		// individual is compliant
 		double lTime = lContext.getClock().getValue(SCHNAPS::Simulation::Clock::eYear);
-		double lCost, lCurrentCost, lDiscountRate;
+		double lCost, lDiscountRate;
 
 		switch (mCost_Ref[0]) {
 			case '@':
@@ -398,16 +416,15 @@ Core::AnyType::Handle Treatment::execute(unsigned int inIndex, Core::ExecutionCo
 		}
 		
 		// add test cost
-		lCost = lCost/std::pow(lDiscountRate + 1, lTime);
-		lCurrentCost = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutCost_Ref.substr(1))).getValue();
-		lContext.getIndividual().getState().setVariable(mOutCost_Ref.substr(1), new Core::Double(lCurrentCost + lCost));
+		lCost = lCost/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb());
+		mAccumulator->accumulate(lContext.getIndividual().getState(), mOutCost_Ref.substr(1), lCost, mCategoryID, lContext.getThreadNb());
 		
 		getArgument(inIndex, 0, ioContext);
 	} else {
 		// individual is not compliant
 		if (mChargeNonCompliant) {
 			double lTime = lContext.getClock().getValue(SCHNAPS::Simulation::Clock::eYear);
-			double lCost, lCurrentCost, lDiscountRate;
+			double lCost, lDiscountRate;
 
 			switch (mCost_Ref[0]) {
 				case '@':
@@ -447,9 +464,8 @@ Core::AnyType::Handle Treatment::execute(unsigned int inIndex, Core::ExecutionCo
 			}
 			
 			// add test cost
-			lCost = lCost/std::pow(lDiscountRate + 1, lTime);
-			lCurrentCost = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutCost_Ref.substr(1))).getValue();
-			lContext.getIndividual().getState().setVariable(mOutCost_Ref.substr(1), new Core::Double(lCurrentCost + lCost));
+			lCost = lCost/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb());
+			mAccumulator->accumulate(lContext.getIndividual().getState(), mOutCost_Ref.substr(1), lCost, mCategoryID, lContext.getThreadNb());
 		}
 		
 		getArgument(inIndex, 1, ioContext);
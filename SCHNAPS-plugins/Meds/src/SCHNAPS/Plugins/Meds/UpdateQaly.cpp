@@ -31,14 +31,20 @@ UpdateQaly::UpdateQaly() :
 	mQaly_Ref(""),
 	mQaly(NULL),
 	mDiscountRate_Ref(""),
-	mDiscountRate(NULL)
+	mDiscountRate(NULL),
+	mCategory(""),
+	mCategoryID(0),
+	mAccumulator(NULL)
 {}
 
 UpdateQaly::UpdateQaly(const UpdateQaly& inOriginal) :
 	mOutQaly_Ref(inOriginal.mOutQaly_Ref.c_str()),
 	mOldQaly_Ref(inOriginal.mOldQaly_Ref.c_str()),
 	mQaly_Ref(inOriginal.mQaly_Ref.c_str()),
-	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str())
+	mDiscountRate_Ref(inOriginal.mDiscountRate_Ref.c_str()),
+	mCategory(inOriginal.mCategory.c_str()),
+	mCategoryID(inOriginal.mCategoryID),
+	mAccumulator(inOriginal.mAccumulator)
 {
 	
 	switch (mQaly_Ref[0]) {
@@ -130,6 +136,10 @@ UpdateQaly& UpdateQaly::operator=(const UpdateQaly& inOriginal) {
 			break;
 	}
 
+	mCategory.assign(inOriginal.mCategory.c_str());
+	mCategoryID = inOriginal.mCategoryID;
+	mAccumulator = inOriginal.mAccumulator;
+
 	return *this;
 	schnaps_StackTraceEndM("SCHNAPS::Plugins::Meds::UpdateQaly& SCHNAPS::Plugins::Meds::UpdateQaly::operator=(const SCHNAPS::Plugins::Meds::UpdateQaly&)");
 }
@@ -223,6 +233,11 @@ void UpdateQaly::readWithSystem(PACC::XML::ConstIterator inIter, Core::System& i
 			break;
 		}
 
+
+	// retrieve category of accumulated QALYs (by default, the output qaly destination)
+	mCategory.assign(inIter->getAttribute("inCategory"));
+	mAccumulator = Accumulator::install(ioSystem);
+	mCategoryID = mAccumulator->getCategoryID(mCategory.empty() ? mOutQaly_Ref.substr(1) : mCategory);
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::UpdateQaly::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -237,6 +252,9 @@ void UpdateQaly::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) co
 	ioStreamer.insertAttribute("inOldQaly", mOldQaly_Ref);
 	ioStreamer.insertAttribute("inQaly", mQaly_Ref);
 	ioStreamer.insertAttribute("inDiscountRate", mDiscountRate_Ref);
+	if (!mCategory.empty()) {
+		ioStreamer.insertAttribute("inCategory", mCategory);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Plugins::Meds::UpdateQaly::writeContent(PACC::XML::Streamer&, bool) const");
 }
 
@@ -293,7 +311,7 @@ Core::AnyType::Handle UpdateQaly::execute(unsigned int inIndex, Core::ExecutionC
 	lTotalQaly = Core::castObjectT<const Core::Double&>(lContext.getIndividual().getState().getVariable(mOutQaly_Ref.substr(1))).getValue();
 	
 	lContext.getIndividual().getState().setVariable(mOldQaly_Ref.substr(1), new Core::Double(lTotalQaly));
-	lContext.getIndividual().getState().setVariable(mOutQaly_Ref.substr(1), new Core::Double(lTotalQaly+lQaly/std::pow(lDiscountRate + 1, lTime)));
+	mAccumulator->accumulate(lContext.getIndividual().getState(), mOutQaly_Ref.substr(1), lQaly/mAccumulator->getDiscountDivisor(lDiscountRate, lTime, lContext.getThreadNb()), mCategoryID, lContext.getThreadNb());
 	
 	
 	return NULL;
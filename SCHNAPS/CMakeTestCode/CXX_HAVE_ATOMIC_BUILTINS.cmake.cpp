@@ -0,0 +1,5 @@
+int main(int,char**){
+	unsigned int lCounter = 0;
+	__sync_add_and_fetch(&lCounter, 1);
+	return __sync_sub_and_fetch(&lCounter, 1);
+	}
@@ -32,6 +32,8 @@
 #include "Core/Object.hpp"
 #include "Core/AnyType.hpp"
 #include "Core/Vector.hpp"
+#include "Core/ContactGraph.hpp"
+#include "Core/ContactList.hpp"
 #include "Core/Atom.hpp"
 #include "Core/Number.hpp"
 #include "Core/Pointer.hpp"
@@ -61,6 +63,7 @@
 #include "Core/MapT.hpp"
 #include "Core/ArrayT.hpp"
 #include "Core/RouletteT.hpp"
+#include "Core/AliasTable.hpp"
 #include "Core/Bool.hpp"
 #include "Core/Char.hpp"
 #include "Core/Int.hpp"
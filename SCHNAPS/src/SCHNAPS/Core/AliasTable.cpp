@@ -0,0 +1,174 @@
+/*
+ * AliasTable.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+
+using namespace SCHNAPS;
+using namespace Core;
+
+/*!
+ * \brief Construct a table from weights.
+ * \param inWeights A const reference to the weights of indexes.
+ */
+AliasTable::AliasTable(const std::vector<double>& inWeights) :
+	mPublished(0)
+{
+	build(inWeights);
+}
+
+/*!
+ * \brief Build the table from weights.
+ * \param inWeights A const reference to the weights of indexes (not necessarily normalized).
+ * \throw SCHNAPS::Core::RunTimeException if there is no weight, if a weight is negative or if weights sum to zero.
+ */
+void AliasTable::build(const std::vector<double>& inWeights) {
+	schnaps_StackTraceBeginM();
+	double lTotal = 0;
+	for (unsigned int i = 0; i < inWeights.size(); i++) {
+		if (inWeights[i] < 0) {
+			throw schnaps_RunTimeExceptionM("The weights of alias table must be positive; could not build it.");
+		}
+		lTotal += inWeights[i];
+	}
+	if (lTotal <= 0) {
+		throw schnaps_RunTimeExceptionM("The weights of alias table must sum to a positive value; could not build it.");
+	}
+	
+	unsigned int lSize = inWeights.size();
+	mWeights = inWeights;
+	mProbabilities.resize(lSize);
+	mAliases.resize(lSize);
+	
+	// scale weights so that the mean is one, and split columns in small and large ones
+	std::vector<unsigned int> lSmall, lLarge;
+	for (unsigned int i = 0; i < lSize; i++) {
+		mProbabilities[i] = inWeights[i] * lSize / lTotal;
+		mAliases[i] = i;
+		if (mProbabilities[i] < 1) {
+			lSmall.push_back(i);
+		} else {
+			lLarge.push_back(i);
+		}
+	}
+	
+	// fill each small column with the excess of a large one
+	unsigned int lLess, lMore;
+	while (lSmall.empty() == false && lLarge.empty() == false) {
+		lLess = lSmall.back();
+		lSmall.pop_back();
+		lMore = lLarge.back();
+		
+		mAliases[lLess] = lMore;
+		mProbabilities[lMore] -= 1 - mProbabilities[lLess];
+		if (mProbabilities[lMore] < 1) {
+			lLarge.pop_back();
+			lSmall.push_back(lMore);
+		}
+	}
+	
+	// remaining columns are full (up to rounding errors)
+	for (unsigned int i = 0; i < lSmall.size(); i++) {
+		mProbabilities[lSmall[i]] = 1;
+	}
+	for (unsigned int i = 0; i < lLarge.size(); i++) {
+		mProbabilities[lLarge[i]] = 1;
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::AliasTable::build(const std::vector<double>&)");
+}
+
+/*!
+ * \brief Build the table from a vector of weights.
+ * \param inWeights A const reference to the vector of weights (as doubles).
+ */
+void AliasTable::build(const Vector& inWeights) {
+	schnaps_StackTraceBeginM();
+	std::vector<double> lWeights(inWeights.size());
+	for (unsigned int i = 0; i < inWeights.size(); i++) {
+		lWeights[i] = castObjectT<const Double&>(*inWeights[i]).getValue();
+	}
+	build(lWeights);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::AliasTable::build(const SCHNAPS::Core::Vector&)");
+}
+
+/*!
+ * \brief  Return an index selected according to a vector of weights, rebuilding the table if its version changed.
+ * \param  inWeights A const reference to the vector of weights (as doubles).
+ * \param  inVersion The version of weights (changed whenever weights change).
+ * \param  ioRandomizer A reference to the randomizer used to select index.
+ * \return The index selected.
+ *
+ * With atomic builtins, the published version is read with a barrier and no lock, so that the table
+ * built for it is visible once it matches; the table is locked only to be rebuilt, once after weights
+ * change. Otherwise, the table is locked while compared and used. Weights must not change while
+ * selections are made.
+ */
+unsigned int AliasTable::select(const Vector& inWeights, unsigned long inVersion, Randomizer& ioRandomizer) {
+	schnaps_StackTraceBeginM();
+#ifdef SCHNAPS_HAVE_ATOMIC_BUILTINS
+	if (__sync_fetch_and_add(&mPublished, 0) != inVersion + 1) {
+		rebuild(inWeights, inVersion);
+	}
+	return select(ioRandomizer);
+#else
+	mMutex.lock();
+	try {
+		if (mPublished != inVersion + 1) {
+			rebuild(inWeights, inVersion);
+		}
+		unsigned int lIndex = select(ioRandomizer);
+		mMutex.unlock();
+		return lIndex;
+	} catch (...) {
+		mMutex.unlock();
+		throw;
+	}
+#endif
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::AliasTable::select(const SCHNAPS::Core::Vector&, unsigned long, SCHNAPS::Core::Randomizer&)");
+}
+
+/*!
+ * \brief Rebuild the table from a vector of weights and publish its version, unless done by another thread.
+ * \param inWeights A const reference to the vector of weights (as doubles).
+ * \param inVersion The version of weights.
+ *
+ * With atomic builtins, the table is locked here and the version is published with a barrier once
+ * the table is built. Otherwise, the caller holds the lock.
+ */
+void AliasTable::rebuild(const Vector& inWeights, unsigned long inVersion) {
+	schnaps_StackTraceBeginM();
+#ifdef SCHNAPS_HAVE_ATOMIC_BUILTINS
+	mMutex.lock();
+	try {
+		unsigned long lPublished = __sync_fetch_and_add(&mPublished, 0);
+		if (lPublished != inVersion + 1) {
+			build(inWeights);
+			__sync_bool_compare_and_swap(&mPublished, lPublished, inVersion + 1);
+		}
+	} catch (...) {
+		mMutex.unlock();
+		throw;
+	}
+	mMutex.unlock();
+#else
+	build(inWeights);
+	mPublished = inVersion + 1;
+#endif
+	schnaps_StackTraceEndM("void SCHNAPS::Core::AliasTable::rebuild(const SCHNAPS::Core::Vector&, unsigned long)");
+}
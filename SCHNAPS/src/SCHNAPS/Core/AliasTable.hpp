@@ -0,0 +1,122 @@
+/*
+ * AliasTable.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Core_AliasTable_hpp
+#define SCHNAPS_Core_AliasTable_hpp
+
+#include "SCHNAPS/Core/Object.hpp"
+#include "SCHNAPS/Core/AllocatorT.hpp"
+#include "SCHNAPS/Core/PointerT.hpp"
+#include "SCHNAPS/Core/ContainerT.hpp"
+#include "SCHNAPS/Core/Randomizer.hpp"
+#include "SCHNAPS/Core/Vector.hpp"
+
+#include "PACC/Threading.hpp"
+
+#include <vector>
+
+namespace SCHNAPS {
+namespace Core {
+
+/*!
+ * \class AliasTable SCHNAPS/Core/AliasTable.hpp "SCHNAPS/Core/AliasTable.hpp"
+ * \brief Sampler of indexes according to weights, using the alias method (Vose).
+ *
+ * The table is built in linear time, then each selection takes one uniform draw, whatever
+ * the number of weights. Selection according to a versioned vector of weights rebuilds the
+ * table only when the version changes, and may be called concurrently.
+ */
+class AliasTable: public Object {
+public:
+	//! AliasTable allocator type.
+	typedef AllocatorT<AliasTable, Object::Alloc> Alloc;
+	//! AliasTable handle type.
+	typedef PointerT<AliasTable, Object::Handle> Handle;
+	//! AliasTable bag type.
+	typedef ContainerT<AliasTable, Object::Bag> Bag;
+
+	AliasTable() : mPublished(0) {}
+	explicit AliasTable(const std::vector<double>& inWeights);
+	virtual ~AliasTable() {}
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("AliasTable");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::AliasTable::getName() const");
+	}
+
+	//! Build the table from weights.
+	void build(const std::vector<double>& inWeights);
+	//! Return an index selected according to a vector of weights, rebuilding the table if its version changed.
+	unsigned int select(const Vector& inWeights, unsigned long inVersion, Randomizer& ioRandomizer);
+
+	/*!
+	 * \brief  Return an index selected according to weights of table.
+	 * \param  ioRandomizer A reference to the randomizer used to select index.
+	 * \return The index selected.
+	 * \throw  SCHNAPS::Core::AssertException if the table is empty.
+	 */
+	unsigned int select(Randomizer& ioRandomizer) const {
+		schnaps_StackTraceBeginM();
+		schnaps_AssertM(mProbabilities.empty() == false);
+		// integer part selects column, fractional part selects between column and its alias
+		double lDice = ioRandomizer.rollUniform(0., mProbabilities.size());
+		unsigned int lColumn = static_cast<unsigned int>(lDice);
+		if (lColumn >= mProbabilities.size()) {
+			lColumn = mProbabilities.size() - 1;
+		}
+		if (lDice - lColumn < mProbabilities[lColumn]) {
+			return lColumn;
+		}
+		return mAliases[lColumn];
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::AliasTable::select(SCHNAPS::Core::Randomizer&) const");
+	}
+
+	/*!
+	 * \brief  Return a const reference to the weights of table.
+	 * \return A const reference to the weights of table.
+	 */
+	const std::vector<double>& getWeights() const {
+		schnaps_StackTraceBeginM();
+		return mWeights;
+		schnaps_StackTraceEndM("const std::vector<double>& SCHNAPS::Core::AliasTable::getWeights() const");
+	}
+
+private:
+	//! Build the table from a vector of weights.
+	void build(const Vector& inWeights);
+	//! Rebuild the table from a vector of weights and publish its version, unless done by another thread.
+	void rebuild(const Vector& inWeights, unsigned long inVersion);
+
+	// not copyable (mutex)
+	AliasTable(const AliasTable& inOriginal);
+	AliasTable& operator=(const AliasTable& inOriginal);
+
+	std::vector<double> mWeights;			//!< Weights of indexes.
+	std::vector<double> mProbabilities;		//!< Probability of keeping the index of each column (else its alias).
+	std::vector<unsigned int> mAliases;		//!< Alias of each column.
+	unsigned long mPublished;				//!< Version of weights the table was built from, plus one (0 if not built).
+	PACC::Threading::Mutex mMutex;			//!< Lock for rebuilding the table.
+};
+} // end of Core namespace
+} // end of SCHNAPS namespace
+
+#endif // SCHNAPS_Core_AliasTable_hpp
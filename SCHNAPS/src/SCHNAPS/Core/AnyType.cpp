@@ -65,3 +65,16 @@ AnyType::Handle AnyType::clone() const {
 	throw schnaps_UndefinedMethodInternalExceptionM("clone", "AnyType", getName());
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::AnyType::clone() const");
 }
+
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ *
+ * The default implementation writes the original to a string and reads it back; subclasses
+ * assign the value directly.
+ */
+void AnyType::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	readStr(inOriginal.writeStr());
+	schnaps_StackTraceEndM("void SCHNAPS::Core::AnyType::copyValue(const SCHNAPS::Core::AnyType&)");
+}
@@ -78,6 +78,8 @@ public:
 	
 	//! Return a handle to a clone (deep copy).
 	virtual AnyType::Handle clone() const;
+	//! Set the value to the value of another object of same type.
+	virtual void copyValue(const AnyType& inOriginal);
 };
 } // end of Core namespace
 } // end of SCHNAPS namespace
@@ -126,3 +126,13 @@ AnyType::Handle Bool::clone() const {
 	return new Bool(*this);
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::Bool::clone() const");
 }
+
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void Bool::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const Bool&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Bool::copyValue(const SCHNAPS::Core::AnyType&)");
+}
@@ -117,3 +117,13 @@ AnyType::Handle Char::clone() const {
 	return new Char(*this);
 	schnaps_StackTraceEndM("SCHNAPS::Core::Atom::Handle SCHNAPS::Core::Char::clone() const");
 }
+
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void Char::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const Char&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Char::copyValue(const SCHNAPS::Core::AnyType&)");
+}
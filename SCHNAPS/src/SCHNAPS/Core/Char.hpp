@@ -85,6 +85,8 @@ public:
 
 	//! Return a handle to a clone (deep copy).
 	virtual AnyType::Handle clone() const;
+	//! Set the value to the value of another object of same type.
+	virtual void copyValue(const AnyType& inOriginal);
 
 	/*!
 	 * \brief Return a const reference to the value of char.
@@ -38,6 +38,13 @@ Component::Component(std::string inName) :
 void Component::init(System& ioSystem)
 {}
 
+/*!
+ * \brief Reset this component before a simulation.
+ * \param ioSystem A reference to the system.
+ */
+void Component::reset(System& ioSystem)
+{}
+
 /*!
  * \brief Read object from XML using system.
  * \param inIter XML iterator of input document.
@@ -56,6 +56,8 @@ public:
 
 	//! Initialize the component.
 	virtual void init(System& ioSystem);
+	//! Reset the component before a simulation.
+	virtual void reset(System& ioSystem);
 
 	/*!
 	 * \brief Return a const reference to the name of the component.
@@ -0,0 +1,177 @@
+/*
+ * ContactGraph.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+
+#include <algorithm>
+
+using namespace SCHNAPS;
+using namespace Core;
+
+/*!
+ * \brief Write object content to XML.
+ * \param ioStreamer XML streamer to output document.
+ * \param inIndent Wether to indent or not.
+ */
+void ContactGraph::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
+	schnaps_StackTraceBeginM();
+	ioStreamer.insertAttribute("nodes", getNumberNodes());
+	ioStreamer.insertAttribute("contacts", getNumberContacts());
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::writeContent(PACC::XML::Streamer&, bool) const");
+}
+
+/*!
+ * \brief Build the graph from per-node neighbour lists.
+ * \param inAdjacency Neighbour list of each node, in generation order.
+ */
+void ContactGraph::build(const std::vector<std::vector<unsigned int> >& inAdjacency) {
+	schnaps_StackTraceBeginM();
+	mOffsets.resize(inAdjacency.size()+1);
+	mOffsets[0] = 0;
+	for (unsigned int i = 0; i < inAdjacency.size(); i++) {
+		mOffsets[i+1] = mOffsets[i] + inAdjacency[i].size();
+	}
+
+	std::vector<unsigned int>(mOffsets.back()).swap(mTargets);
+	for (unsigned int i = 0; i < inAdjacency.size(); i++) {
+		std::copy(inAdjacency[i].begin(), inAdjacency[i].end(), mTargets.begin() + mOffsets[i]);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::build(const std::vector<std::vector<unsigned int> >&)");
+}
+
+/*!
+ * \brief Build the graph from a list of reciprocal contacts.
+ * \param inNumberNodes Number of nodes in the graph.
+ * \param inEdges List of contacts, each one being added to the rows of both nodes.
+ *
+ * When the list is sorted and free of duplicates, each row is also sorted.
+ */
+void ContactGraph::build(unsigned int inNumberNodes, const std::vector<std::pair<unsigned int, unsigned int> >& inEdges) {
+	schnaps_StackTraceBeginM();
+	// count contacts of each node
+	mOffsets.assign(inNumberNodes+1, 0);
+	for (unsigned long i = 0; i < inEdges.size(); i++) {
+		schnaps_UpperBoundCheckAssertM(inEdges[i].first, inNumberNodes-1);
+		schnaps_UpperBoundCheckAssertM(inEdges[i].second, inNumberNodes-1);
+		mOffsets[inEdges[i].first+1]++;
+		mOffsets[inEdges[i].second+1]++;
+	}
+	for (unsigned int i = 0; i < inNumberNodes; i++) {
+		mOffsets[i+1] += mOffsets[i];
+	}
+
+	// fill rows
+	std::vector<unsigned int>(mOffsets.back()).swap(mTargets);
+	std::vector<unsigned long> lNext(mOffsets.begin(), mOffsets.end()-1);
+	for (unsigned long i = 0; i < inEdges.size(); i++) {
+		mTargets[lNext[inEdges[i].first]++] = inEdges[i].second;
+		mTargets[lNext[inEdges[i].second]++] = inEdges[i].first;
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::build(unsigned int, const std::vector<std::pair<unsigned int, unsigned int> >&)");
+}
+
+/*!
+ * \brief Remove all nodes and contacts, releasing memory.
+ */
+void ContactGraph::clear() {
+	schnaps_StackTraceBeginM();
+	std::vector<unsigned long>().swap(mOffsets);
+	std::vector<unsigned int>().swap(mTargets);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::clear()");
+}
+
+/*!
+ * \brief Renumber nodes according to a specific order.
+ * \param inOrder Old index of the node to put at each new position.
+ */
+void ContactGraph::permute(const std::vector<unsigned int>& inOrder) {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbNodes = getNumberNodes();
+	schnaps_AssertM(inOrder.size() == lNbNodes);
+
+	std::vector<unsigned int> lNewIndexes(lNbNodes);
+	for (unsigned int i = 0; i < lNbNodes; i++) {
+		lNewIndexes[inOrder[i]] = i;
+	}
+
+	std::vector<unsigned long> lOffsets(lNbNodes+1);
+	std::vector<unsigned int> lTargets(mTargets.size());
+	lOffsets[0] = 0;
+	for (unsigned int i = 0; i < lNbNodes; i++) {
+		unsigned long lBegin = mOffsets[inOrder[i]];
+		unsigned long lEnd = mOffsets[inOrder[i]+1];
+		lOffsets[i+1] = lOffsets[i] + (lEnd - lBegin);
+		for (unsigned long j = lBegin; j < lEnd; j++) {
+			lTargets[lOffsets[i] + j - lBegin] = lNewIndexes[mTargets[j]];
+		}
+	}
+	mOffsets.swap(lOffsets);
+	mTargets.swap(lTargets);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::permute(const std::vector<unsigned int>&)");
+}
+
+/*!
+ * \brief Compute the reverse Cuthill-McKee order of nodes, which brings neighbours close to each other.
+ * \param outOrder Old index of the node to put at each new position.
+ *
+ * Each connected component is traversed breadth-first from one of its nodes of lowest degree,
+ * visiting neighbours by increasing degree, and the whole order is reversed at the end.
+ */
+void ContactGraph::computeReverseCuthillMcKee(std::vector<unsigned int>& outOrder) const {
+	schnaps_StackTraceBeginM();
+	unsigned int lNbNodes = getNumberNodes();
+	outOrder.clear();
+	outOrder.reserve(lNbNodes);
+
+	// candidate roots by increasing degree
+	std::vector<std::pair<unsigned int, unsigned int> > lRoots(lNbNodes);
+	for (unsigned int i = 0; i < lNbNodes; i++) {
+		lRoots[i] = std::make_pair(getDegree(i), i);
+	}
+	std::sort(lRoots.begin(), lRoots.end());
+
+	std::vector<bool> lVisited(lNbNodes, false);
+	std::vector<std::pair<unsigned int, unsigned int> > lNeighbours;
+	for (unsigned int r = 0; r < lNbNodes; r++) {
+		if (lVisited[lRoots[r].second]) {
+			continue;
+		}
+		// outOrder is used as the breadth-first queue
+		unsigned int lHead = outOrder.size();
+		outOrder.push_back(lRoots[r].second);
+		lVisited[lRoots[r].second] = true;
+		while (lHead < outOrder.size()) {
+			unsigned int lNode = outOrder[lHead++];
+			lNeighbours.clear();
+			for (unsigned long j = mOffsets[lNode]; j < mOffsets[lNode+1]; j++) {
+				if (lVisited[mTargets[j]] == false) {
+					lVisited[mTargets[j]] = true;
+					lNeighbours.push_back(std::make_pair(getDegree(mTargets[j]), mTargets[j]));
+				}
+			}
+			std::sort(lNeighbours.begin(), lNeighbours.end());
+			for (unsigned int j = 0; j < lNeighbours.size(); j++) {
+				outOrder.push_back(lNeighbours[j].second);
+			}
+		}
+	}
+	std::reverse(outOrder.begin(), outOrder.end());
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactGraph::computeReverseCuthillMcKee(std::vector<unsigned int>&) const");
+}
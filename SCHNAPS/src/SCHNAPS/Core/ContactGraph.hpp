@@ -0,0 +1,159 @@
+/*
+ * ContactGraph.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Core_ContactGraph_hpp
+#define SCHNAPS_Core_ContactGraph_hpp
+
+#include "SCHNAPS/Core/Object.hpp"
+#include "SCHNAPS/Core/AllocatorT.hpp"
+#include "SCHNAPS/Core/PointerT.hpp"
+#include "SCHNAPS/Core/ContainerT.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace SCHNAPS {
+namespace Core {
+
+/*!
+ * \class ContactGraph SCHNAPS/Core/ContactGraph.hpp "SCHNAPS/Core/ContactGraph.hpp"
+ * \brief Contact network stored in compressed sparse row form.
+ *
+ * The neighbours of node i are mTargets[mOffsets[i]] to mTargets[mOffsets[i+1]-1],
+ * in the order they were generated. The graph is immutable once built and can be
+ * shared between individuals and threads.
+ */
+class ContactGraph: public Object {
+public:
+	//! ContactGraph allocator type.
+	typedef AllocatorT<ContactGraph, Object::Alloc> Alloc;
+	//! ContactGraph handle type.
+	typedef PointerT<ContactGraph, Object::Handle> Handle;
+	//! ContactGraph bag type.
+	typedef ContainerT<ContactGraph, Object::Bag> Bag;
+
+	ContactGraph() {}
+	virtual ~ContactGraph() {}
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("ContactGraph");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::ContactGraph::getName() const");
+	}
+
+	//! Write the content of the object to XML.
+	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
+
+	//! Build the graph from per-node neighbour lists.
+	void build(const std::vector<std::vector<unsigned int> >& inAdjacency);
+	//! Build the graph from a list of reciprocal contacts.
+	void build(unsigned int inNumberNodes, const std::vector<std::pair<unsigned int, unsigned int> >& inEdges);
+	//! Remove all nodes and contacts.
+	void clear();
+	//! Renumber nodes according to a specific order.
+	void permute(const std::vector<unsigned int>& inOrder);
+	//! Compute the reverse Cuthill-McKee order of nodes.
+	void computeReverseCuthillMcKee(std::vector<unsigned int>& outOrder) const;
+
+	/*!
+	 * \brief  Return the number of nodes.
+	 * \return The number of nodes.
+	 */
+	unsigned int getNumberNodes() const {
+		schnaps_StackTraceBeginM();
+		return mOffsets.empty() ? 0 : mOffsets.size() - 1;
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::ContactGraph::getNumberNodes() const");
+	}
+
+	/*!
+	 * \brief  Return the total number of stored contacts (each reciprocal contact counts twice).
+	 * \return The total number of stored contacts.
+	 */
+	unsigned long getNumberContacts() const {
+		schnaps_StackTraceBeginM();
+		return mTargets.size();
+		schnaps_StackTraceEndM("unsigned long SCHNAPS::Core::ContactGraph::getNumberContacts() const");
+	}
+
+	/*!
+	 * \brief  Return the number of contacts of a specific node.
+	 * \param  inNode Index of the node.
+	 * \return The number of contacts of the node.
+	 */
+	unsigned int getDegree(unsigned int inNode) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inNode, getNumberNodes()-1);
+		return mOffsets[inNode+1] - mOffsets[inNode];
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::ContactGraph::getDegree(unsigned int) const");
+	}
+
+	/*!
+	 * \brief  Return a pointer to the first contact of a specific node.
+	 * \param  inNode Index of the node.
+	 * \return A pointer to the first contact of the node.
+	 */
+	const unsigned int* getNeighboursBegin(unsigned int inNode) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inNode, getNumberNodes()-1);
+		return mTargets.empty() ? NULL : &mTargets[0] + mOffsets[inNode];
+		schnaps_StackTraceEndM("const unsigned int* SCHNAPS::Core::ContactGraph::getNeighboursBegin(unsigned int) const");
+	}
+
+	/*!
+	 * \brief  Return a pointer past the last contact of a specific node.
+	 * \param  inNode Index of the node.
+	 * \return A pointer past the last contact of the node.
+	 */
+	const unsigned int* getNeighboursEnd(unsigned int inNode) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inNode, getNumberNodes()-1);
+		return mTargets.empty() ? NULL : &mTargets[0] + mOffsets[inNode+1];
+		schnaps_StackTraceEndM("const unsigned int* SCHNAPS::Core::ContactGraph::getNeighboursEnd(unsigned int) const");
+	}
+
+	/*!
+	 * \brief  Return a const reference to the row offsets.
+	 * \return A const reference to the row offsets.
+	 */
+	const std::vector<unsigned long>& getOffsets() const {
+		schnaps_StackTraceBeginM();
+		return mOffsets;
+		schnaps_StackTraceEndM("const std::vector<unsigned long>& SCHNAPS::Core::ContactGraph::getOffsets() const");
+	}
+
+	/*!
+	 * \brief  Return a const reference to the contact targets.
+	 * \return A const reference to the contact targets.
+	 */
+	const std::vector<unsigned int>& getTargets() const {
+		schnaps_StackTraceBeginM();
+		return mTargets;
+		schnaps_StackTraceEndM("const std::vector<unsigned int>& SCHNAPS::Core::ContactGraph::getTargets() const");
+	}
+
+protected:
+	std::vector<unsigned long> mOffsets;	//!< Offset of the first contact of each node (number of nodes + 1 entries).
+	std::vector<unsigned int> mTargets;		//!< Contacts of all nodes, stored row after row.
+};
+} // end of Core namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Core_ContactGraph_hpp */
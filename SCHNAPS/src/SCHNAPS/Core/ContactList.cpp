@@ -0,0 +1,113 @@
+/*
+ * ContactList.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+
+using namespace SCHNAPS;
+using namespace Core;
+
+/*!
+ * \brief Default constructor.
+ */
+ContactList::ContactList() :
+	mGraph(NULL),
+	mNode(0)
+{}
+
+/*!
+ * \brief Construct a view over the contacts of a specific node.
+ * \param inGraph Handle to the contact graph.
+ * \param inNode Node of the graph to view.
+ */
+ContactList::ContactList(ContactGraph::Handle inGraph, unsigned int inNode) :
+	mGraph(inGraph),
+	mNode(inNode)
+{}
+
+/*!
+ * \brief Construct a contact list as a copy of an original.
+ * \param inOriginal A const reference to the original contact list.
+ */
+ContactList::ContactList(const ContactList& inOriginal) :
+	mGraph(inOriginal.mGraph),
+	mNode(inOriginal.mNode)
+{}
+
+/*!
+ * \brief Copy operator.
+ * \param inOriginal Source of copy.
+ * \return A reference to the current object.
+ */
+ContactList& ContactList::operator=(const ContactList& inOriginal) {
+	schnaps_StackTraceBeginM();
+	mGraph = inOriginal.mGraph;
+	mNode = inOriginal.mNode;
+	return *this;
+	schnaps_StackTraceEndM("SCHNAPS::Core::ContactList& SCHNAPS::Core::ContactList::operator=(const SCHNAPS::Core::ContactList&)");
+}
+
+/*!
+ * \brief Write object content to XML.
+ * \param ioStreamer XML streamer to output document.
+ * \param inIndent Wether to indent or not.
+ */
+void ContactList::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const {
+	schnaps_StackTraceBeginM();
+	ioStreamer.insertAttribute("value", writeStr());
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactList::writeContent(PACC::XML::Streamer&, bool) const");
+}
+
+/*!
+ * \brief Read the object from string.
+ * \param inStr String to read the object from.
+ * \throw SCHNAPS::Core::InternalException because a contact list is a read-only view.
+ */
+void ContactList::readStr(const std::string& inStr) {
+	schnaps_StackTraceBeginM();
+	throw schnaps_UndefinedMethodInternalExceptionM("readStr", "ContactList", getName());
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactList::readStr(const std::string&)");
+}
+
+/*!
+ * \brief  Write the object to string, using the same format as a vector of unsigned integers.
+ * \return The object as string.
+ */
+std::string ContactList::writeStr() const {
+	schnaps_StackTraceBeginM();
+	std::ostringstream lOSS;
+	for (const unsigned int* lIt = begin(); lIt != end(); lIt++) {
+		if (lIt != begin()) {
+			lOSS << "|";
+		}
+		lOSS << *lIt;
+	}
+	return lOSS.str();
+	schnaps_StackTraceEndM("std::string SCHNAPS::Core::ContactList::writeStr() const");
+}
+
+/*!
+ * \brief  Return a handle to a clone. The graph is immutable and thus shared by the clone.
+ * \return A handle to a clone.
+ */
+AnyType::Handle ContactList::clone() const {
+	schnaps_StackTraceBeginM();
+	return new ContactList(*this);
+	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::ContactList::clone() const");
+}
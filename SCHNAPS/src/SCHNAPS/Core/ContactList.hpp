@@ -0,0 +1,152 @@
+/*
+ * ContactList.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Core_ContactList_hpp
+#define SCHNAPS_Core_ContactList_hpp
+
+#include "SCHNAPS/Core/AnyType.hpp"
+#include "SCHNAPS/Core/AllocatorT.hpp"
+#include "SCHNAPS/Core/ContactGraph.hpp"
+
+namespace SCHNAPS {
+namespace Core {
+
+/*!
+ * \class ContactList SCHNAPS/Core/ContactList.hpp "SCHNAPS/Core/ContactList.hpp"
+ * \brief Read-only view over the contacts of one node of a contact graph.
+ *
+ * It replaces the vector of unsigned integers previously stored in the state of each
+ * individual, while the contacts themselves are held once in the shared graph.
+ */
+class ContactList: public AnyType {
+public:
+	//! ContactList allocator type.
+	typedef AllocatorT<ContactList, AnyType::Alloc> Alloc;
+	//! ContactList handle type.
+	typedef PointerT<ContactList, AnyType::Handle> Handle;
+	//! ContactList bag type.
+	typedef ContainerT<ContactList, AnyType::Bag> Bag;
+
+	ContactList();
+	ContactList(ContactGraph::Handle inGraph, unsigned int inNode);
+	ContactList(const ContactList& inOriginal);
+	virtual ~ContactList() {}
+
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("ContactList");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::ContactList::getName() const");
+	}
+
+	virtual const std::string& getType() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lType("ContactList");
+		return lType;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::ContactList::getType() const");
+	}
+
+	//! Copy operator.
+	ContactList& operator=(const ContactList& inOriginal);
+
+	//! Write the content of the object to XML.
+	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
+
+	//! Read data from string.
+	virtual void readStr(const std::string& inStr);
+	//! Write data to string.
+	virtual std::string writeStr() const;
+
+	//! Return a handle to a clone (deep copy).
+	virtual AnyType::Handle clone() const;
+
+	/*!
+	 * \brief  Return the number of contacts.
+	 * \return The number of contacts.
+	 */
+	unsigned int size() const {
+		schnaps_StackTraceBeginM();
+		schnaps_NonNullPointerAssertM(mGraph);
+		return mGraph->getDegree(mNode);
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::ContactList::size() const");
+	}
+
+	/*!
+	 * \brief  Return the index of a specific contact.
+	 * \param  inIndex Index of the contact in the list.
+	 * \return The index of the contact in the population.
+	 */
+	unsigned int operator[](unsigned int inIndex) const {
+		schnaps_StackTraceBeginM();
+		schnaps_UpperBoundCheckAssertM(inIndex, size()-1);
+		return mGraph->getNeighboursBegin(mNode)[inIndex];
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::ContactList::operator[](unsigned int) const");
+	}
+
+	/*!
+	 * \brief  Return a pointer to the first contact.
+	 * \return A pointer to the first contact.
+	 */
+	const unsigned int* begin() const {
+		schnaps_StackTraceBeginM();
+		schnaps_NonNullPointerAssertM(mGraph);
+		return mGraph->getNeighboursBegin(mNode);
+		schnaps_StackTraceEndM("const unsigned int* SCHNAPS::Core::ContactList::begin() const");
+	}
+
+	/*!
+	 * \brief  Return a pointer past the last contact.
+	 * \return A pointer past the last contact.
+	 */
+	const unsigned int* end() const {
+		schnaps_StackTraceBeginM();
+		schnaps_NonNullPointerAssertM(mGraph);
+		return mGraph->getNeighboursEnd(mNode);
+		schnaps_StackTraceEndM("const unsigned int* SCHNAPS::Core::ContactList::end() const");
+	}
+
+	/*!
+	 * \brief  Return a handle to the underlying graph.
+	 * \return A handle to the underlying graph.
+	 */
+	ContactGraph::Handle getGraph() const {
+		schnaps_StackTraceBeginM();
+		return mGraph;
+		schnaps_StackTraceEndM("SCHNAPS::Core::ContactGraph::Handle SCHNAPS::Core::ContactList::getGraph() const");
+	}
+
+	/*!
+	 * \brief  Return the node of the underlying graph viewed by the list.
+	 * \return The node of the underlying graph.
+	 */
+	unsigned int getNode() const {
+		schnaps_StackTraceBeginM();
+		return mNode;
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Core::ContactList::getNode() const");
+	}
+
+private:
+	ContactGraph::Handle mGraph;	//!< Handle to the shared contact graph.
+	unsigned int mNode;				//!< Node of the graph viewed by the list.
+};
+} // end of Core namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Core_ContactList_hpp */
@@ -27,13 +27,13 @@ using namespace Core;
  * \brief  Generate contacts.
  * \param  inPop Handle to the individuals to generate contacts for
  * \param  inSystem Handle to the system
- * \param  ioList List of contacts
+ * \param  ioGraph Contact graph to build
  * \throw  SCHNAPS::Core::InternalException if the method is not overdefined is a subclass.
  */
-void ContactsGen::generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<Core::Vector::Handle>& ioList) const {
+void ContactsGen::generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, Core::ContactGraph& ioGraph) const {
 	schnaps_StackTraceBeginM();
 	throw schnaps_UndefinedMethodInternalExceptionM("generate", "ContactsGen", getName());
-	schnaps_StackTraceEndM("void ContactsGen::generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<Core::Vector::Handle>& ioList) const");
+	schnaps_StackTraceEndM("void SCHNAPS::Core::ContactsGen::generate(SCHNAPS::Simulation::Individual::Bag::Handle, SCHNAPS::Core::System::Handle, SCHNAPS::Core::ContactGraph&) const");
 }
 
 
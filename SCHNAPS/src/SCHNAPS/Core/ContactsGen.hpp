@@ -26,7 +26,7 @@
 #include "SCHNAPS/Core/PointerT.hpp"
 #include "SCHNAPS/Core/ContainerT.hpp"
 #include "SCHNAPS/Core/System.hpp"
-#include "SCHNAPS/Core/Vector.hpp"
+#include "SCHNAPS/Core/ContactGraph.hpp"
 
 
 #include "SCHNAPS/Simulation/Individual.hpp"
@@ -62,8 +62,8 @@ public:
 		schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::ContactsGen::getName() const");
 	}
 
-	//! Generate contacts
-	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, std::vector<Core::Vector::Handle>& ioList) const;
+	//! Generate contacts into a graph whose nodes are the individuals of the population.
+	virtual void generate(Simulation::Individual::Bag::Handle inPop, Core::System::Handle inSystem, ContactGraph& ioGraph) const;
 
 
 };
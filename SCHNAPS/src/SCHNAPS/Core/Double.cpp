@@ -119,6 +119,16 @@ AnyType::Handle Double::clone() const {
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::Double::clone() const");
 }
 
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void Double::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const Double&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Double::copyValue(const SCHNAPS::Core::AnyType&)");
+}
+
 /*!
  * \brief  Compute the absolute value.
  * \return A handle to the resulting number.
@@ -75,7 +75,7 @@ public:
 	 * \brief Set the executing primitive tree.
 	 * \param inPrimitiveTree A handle to the executing primitive tree.
 	 */
-	void setPrimitiveTree(PrimitiveTree::Handle inPrimitiveTree) {
+	void setPrimitiveTree(const PrimitiveTree* inPrimitiveTree) {
 		mPrimitiveTree = inPrimitiveTree;
 	}
 
@@ -109,7 +109,7 @@ public:
 	 * \brief Return a const handle to the executing primitive tree.
 	 * \return A const handle to the executing primitive tree.
 	 */
-	const PrimitiveTree::Handle getPrimitiveTreeHandle() const {
+	const PrimitiveTree* getPrimitiveTreePointer() const {
 		return mPrimitiveTree;
 	}
 
@@ -164,7 +164,7 @@ public:
 
 protected:
 	System::Handle mSystem;					//!< Handle to the system.
-	PrimitiveTree::Handle mPrimitiveTree;	//!< Handle to the tree that defines the current action.
+	const PrimitiveTree* mPrimitiveTree;	//!< Pointer to the tree that defines the current action (not owned, trees may be shared by threads).
 
 	unsigned int mThreadNb;					//!< Thread nnumber associated to that context.
 };
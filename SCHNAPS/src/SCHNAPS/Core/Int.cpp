@@ -119,6 +119,16 @@ AnyType::Handle Int::clone() const {
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::Int::clone() const");
 }
 
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void Int::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const Int&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Int::copyValue(const SCHNAPS::Core::AnyType&)");
+}
+
 /*!
  * \brief  Compute the absolute value.
  * \return A handle to the resulting number.
@@ -95,6 +95,8 @@ public:
 
 	//! Return a handle to a clone of the current object.
 	virtual AnyType::Handle clone() const;
+	//! Set the value to the value of another object of same type.
+	virtual void copyValue(const AnyType& inOriginal);
 
 	//! Compute absolute value.
 	virtual Number::Handle abs();
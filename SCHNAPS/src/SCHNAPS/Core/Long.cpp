@@ -119,6 +119,16 @@ AnyType::Handle Long::clone() const {
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::Long::clone() const");
 }
 
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void Long::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const Long&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Long::copyValue(const SCHNAPS::Core::AnyType&)");
+}
+
 /*!
  * \brief  Compute the absolute value.
  * \return A handle to the resulting number.
@@ -171,10 +171,16 @@ public:
 
 	/*!
 	 *  \brief  Increments the reference counter and returns a pointer to the actual object.
+	 *
+	 *  The counter is updated atomically when supported, so that objects can be shared between threads.
 	 *  \return Pointer to the actual object.
 	 */
 	Object* refer() {
+#ifdef SCHNAPS_HAVE_ATOMIC_BUILTINS
+		__sync_add_and_fetch(&mRefCounter, 1);
+#else
 		++mRefCounter;
+#endif
 		return this;
 	}
 
@@ -182,7 +188,11 @@ public:
 	 *  \brief  Decrement the reference counter and deletes the actual object if it reaches zero.
 	 */
 	void unrefer() {
+#ifdef SCHNAPS_HAVE_ATOMIC_BUILTINS
+		if (__sync_sub_and_fetch(&mRefCounter, 1) == 0)
+#else
 		if ((--mRefCounter) == 0)
+#endif
 			delete this;
 	}
 
@@ -22,7 +22,8 @@ using namespace Core;
  * \brief Construct object parameters component.
  */
 Parameters::Parameters() :
-	Component("Parameters")
+	Component("Parameters"),
+	mVersion(0)
 {}
 
 /*!
@@ -66,6 +67,7 @@ void Parameters::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSyste
 #endif
 		}
 	}
+	mVersion++;
 	schnaps_StackTraceEndM("void SCHNAPS::Core::Parameters::readWithSystem(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
 
@@ -116,6 +118,7 @@ void Parameters::readStr(const std::string& inStr) {
 			lIterParameters->second->readStr(lOption.substr(lPos+1));
 		}
 	}
+	mVersion++;
 	schnaps_StackTraceEndM("void SCHNAPS::Core::Parameters::readStr(const std::string&)");
 }
 
@@ -174,5 +177,6 @@ void Parameters::setParameter(const std::string& inLabel, const AnyType::Handle
 	}
 	schnaps_NonNullPointerAssertM(lIterParameters->second);
 	lIterParameters->second->readStr(inValue->writeStr());
+	mVersion++;
 	schnaps_StackTraceEndM("void SCHNAPS::Core::Parameters::setParameterValue(const std::string&, const AnyType::Handle)");
 }
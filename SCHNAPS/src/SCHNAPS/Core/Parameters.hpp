@@ -78,6 +78,16 @@ public:
 	
 	//! Set parameter value.
 	void setParameter(const std::string& inLabel, const AnyType::Handle inValue);
+
+	/*!
+	 * \brief  Return the version of parameters, changed whenever parameter values are read or set.
+	 * \return The version of parameters.
+	 */
+	unsigned long getVersion() const {
+		schnaps_StackTraceBeginM();
+		return mVersion;
+		schnaps_StackTraceEndM("unsigned long SCHNAPS::Core::Parameters::getVersion() const");
+	}
 	
 	/*!
 	 * \brief  Return a const reference to the parameter with specific label.
@@ -136,6 +146,7 @@ public:
 
 private:
 	ParametersMap mParametersMap;	//!< The map of parameter labels to values.
+	unsigned long mVersion;			//!< Version of parameter values.
 };
 } // end of Core namespace
 } // end of SCHNAPS namespace
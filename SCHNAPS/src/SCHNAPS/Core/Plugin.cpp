@@ -277,4 +277,18 @@ void Plugin::load(std::string inSource) {
 	PluginSpecFctPtr lFunctPtr = (PluginSpecFctPtr) bindDynLibFunction(mDynLib, "__SCHNAPS_Plugin_getPluginSpecs");
 	lFunctPtr(mLibName, mVersion, mAllocatorMap);
 	mSource = inSource;
+
+	// resolve the file actually loaded, which may have been searched for
+	mPath = inSource;
+#ifdef SCHNAPS_IS_WINDOWS
+	char lPath[MAX_PATH];
+	if (GetModuleFileName((HMODULE) mDynLib, lPath, MAX_PATH) != 0) {
+		mPath = lPath;
+	}
+#else // SCHNAPS_IS_WINDOWS
+	Dl_info lInfo;
+	if (dladdr((void*) lFunctPtr, &lInfo) != 0 && lInfo.dli_fname != NULL) {
+		mPath = lInfo.dli_fname;
+	}
+#endif // SCHNAPS_IS_WINDOWS
 }
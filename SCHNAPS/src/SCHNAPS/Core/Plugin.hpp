@@ -238,6 +238,14 @@ public:
 		return mSource;
 	}
 
+	/*!
+	 *  \brief Get the path of the file the plugin was loaded from.
+	 *  \return Path of the loaded library, as resolved by the dynamic loader.
+	 */
+	const std::string& getPath() const {
+		return mPath;
+	}
+
 	//! Lists all allocators contained in plugin.
 	void listFactories(std::vector<std::string>& outAllocators) const;
 	//! Get allocator of specified name.
@@ -260,6 +268,7 @@ protected:
 	std::string mLibName;				//!< Name of the plugin.
 	std::string mVersion;				//!< Version of the plugin.
 	std::string mSource;				//!< Source of the plugin.
+	std::string mPath;					//!< Path of the loaded library.
 	void* mDynLib;						//!< Opaque handler of the dynamic lib.
 };
 } // end of Core namespace
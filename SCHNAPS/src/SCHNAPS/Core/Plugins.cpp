@@ -103,3 +103,15 @@ void Plugins::insertPlugin(const std::string& inLabel, Plugin::Handle inPlugin)
 	mPluginMap[inLabel] = inPlugin;
 	schnaps_StackTraceEndM("void SCHNAPS::Core::Plugins::insertPlugin(const std::string&, SCHNAPS::Core::Plugin::Handle)");
 }
+
+/*!
+ * \brief List paths of the loaded plugin libraries.
+ * \param outPaths Output for result.
+ */
+void Plugins::listPaths(std::vector<std::string>& outPaths) const {
+	schnaps_StackTraceBeginM();
+	for (PluginMap::const_iterator lIt = mPluginMap.begin(); lIt != mPluginMap.end(); lIt++) {
+		outPaths.push_back(lIt->second->getPath());
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Plugins::listPaths(std::vector<std::string>&) const");
+}
@@ -80,6 +80,8 @@ public:
 
 	//! Insert new plugin.
 	void insertPlugin(const std::string& inLabel, Plugin::Handle inPlugin);
+	//! List paths of the loaded plugin libraries.
+	void listPaths(std::vector<std::string>& outPaths) const;
 	
 	/*!
 	 * \brief Return a handle to the plugin with specific label.
@@ -128,6 +128,24 @@ AnyType::Handle Primitive::execute(unsigned int inIndex, ExecutionContext& ioCon
 	schnaps_StackTraceEndM("AnyType::Handle Primitive::execute(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
 }
 
+/*!
+ * \brief  Return true if the primitive always returns the same value, whatever the individual.
+ *
+ * An invariant primitive does not draw random numbers, does not refer to individual variables
+ * and has no side effect. Arguments are not considered: a sub-tree is invariant if all of its
+ * primitives are (see PrimitiveTree::isInvariant), and can then be interpreted once for a whole
+ * block of individuals. By default, primitives are not considered invariant.
+ *
+ * \param  inIndex Index of the current primitive.
+ * \param  ioContext A reference to the execution context.
+ * \return True if the primitive is invariant, false if not.
+ */
+bool Primitive::isInvariant(unsigned int inIndex, ExecutionContext& ioContext) const {
+	schnaps_StackTraceBeginM();
+	return false;
+	schnaps_StackTraceEndM("bool SCHNAPS::Core::Primitive::isInvariant(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
+}
+
 /*!
  * \brief  Return the nth argument requested return type.
  * \param  inIndex Index of the current primitive.
@@ -87,6 +87,8 @@ public:
 	virtual const std::string& getReturnType(unsigned int inIndex, ExecutionContext& ioContext) const;
 	//! Validate primitive and children recursively.
 	bool isValid(unsigned int inIndex, ExecutionContext& ioContext) const;
+	//! Return true if the primitive always returns the same value, whatever the individual.
+	virtual bool isInvariant(unsigned int inIndex, ExecutionContext& ioContext) const;
 
 	/*!
 	 * \brief  Return the number of arguments of primitive.
@@ -204,6 +204,97 @@ void PrimitiveTree::validate(ExecutionContext& ioContext) const {
 	schnaps_StackTraceEndM("const std::string& SCHNAPS::Core::PrimitiveTree::getReturnType(SCHNAPS::Core::ExecutionContext&) const");
 }
 
+/*!
+ *  \brief  Return true if the primitive tree always returns the same value, whatever the individual.
+ *  \param  ioContext A reference to the execution context.
+ *  \return True if every primitive of tree is invariant, false if not.
+ */
+bool PrimitiveTree::isInvariant(ExecutionContext& ioContext) const {
+	schnaps_StackTraceBeginM();
+	if (empty()) {
+		return false;
+	}
+	ioContext.setPrimitiveTree(this);
+	return isInvariant(0, ioContext);
+	schnaps_StackTraceEndM("bool SCHNAPS::Core::PrimitiveTree::isInvariant(SCHNAPS::Core::ExecutionContext&) const");
+}
+
+/*!
+ *  \brief  Return true if a primitive sub-tree always returns the same value, whatever the individual.
+ *  \param  inIndex Index of the root of sub-tree.
+ *  \param  ioContext A reference to the execution context, whose current primitive tree is this one.
+ *  \return True if every primitive of sub-tree is invariant, false if not.
+ */
+bool PrimitiveTree::isInvariant(unsigned int inIndex, ExecutionContext& ioContext) const {
+	schnaps_StackTraceBeginM();
+	schnaps_UpperBoundCheckAssertM(inIndex, size()-1);
+	for (unsigned int i = inIndex; i < inIndex + (*this)[inIndex].mSubTreeSize; i++) {
+		if ((*this)[i].mPrimitive->isInvariant(i, ioContext) == false) {
+			return false;
+		}
+	}
+	return true;
+	schnaps_StackTraceEndM("bool SCHNAPS::Core::PrimitiveTree::isInvariant(unsigned int, SCHNAPS::Core::ExecutionContext&) const");
+}
+
+/*!
+ *  \brief  Return true if the primitive tree refers to a specific variable.
+ *  \param  inReference A const reference to the variable reference (e.g. "@label" for an individual variable).
+ *  \return True if an attribute of a primitive is exactly the reference, false if not.
+ */
+bool PrimitiveTree::refersTo(const std::string& inReference) const {
+	schnaps_StackTraceBeginM();
+	std::vector<std::string> lReferences;
+	listReferences(lReferences);
+	return std::find(lReferences.begin(), lReferences.end(), inReference) != lReferences.end();
+	schnaps_StackTraceEndM("bool SCHNAPS::Core::PrimitiveTree::refersTo(const std::string&) const");
+}
+
+/*!
+ *  \brief Append the variables referred to by the primitives of tree to a list.
+ *  \param ioReferences A reference to the list of variable references (e.g. "@label" for an individual variable).
+ *
+ *  Each primitive is written on its own, and every attribute value that starts with a reference
+ *  prefix (@, #, % or $) is appended as a whole.
+ */
+void PrimitiveTree::listReferences(std::vector<std::string>& ioReferences) const {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < size(); i++) {
+		std::ostringstream lOSS;
+		PACC::XML::Streamer lStreamer(lOSS);
+		(*this)[i].mPrimitive->write(lStreamer, false);
+		const std::string lNode = lOSS.str();
+
+		// attribute values are quoted, quotes being escaped inside values
+		std::string::size_type lBegin = lNode.find("=\"");
+		while (lBegin != std::string::npos) {
+			lBegin += 2;
+			std::string::size_type lEnd = lNode.find('"', lBegin);
+			if (lEnd == std::string::npos) {
+				break;
+			}
+			if (lEnd > lBegin && std::strchr("@#%$", lNode[lBegin]) != NULL) {
+				ioReferences.push_back(lNode.substr(lBegin, lEnd - lBegin));
+			}
+			lBegin = lNode.find("=\"", lEnd + 1);
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::PrimitiveTree::listReferences(std::vector<std::string>&) const");
+}
+
+/*!
+ *  \brief  Return the primitive tree written to a XML string.
+ *  \return The primitive tree written to a XML string, without indentation.
+ */
+std::string PrimitiveTree::writeStr() const {
+	schnaps_StackTraceBeginM();
+	std::ostringstream lOSS;
+	PACC::XML::Streamer lStreamer(lOSS);
+	write(lStreamer, false);
+	return lOSS.str();
+	schnaps_StackTraceEndM("std::string SCHNAPS::Core::PrimitiveTree::writeStr() const");
+}
+
 /*!
  *  \brief  Read a primitive subtree from a XML subtree.
  *  \param  inIter XML iterator to read primitive tree from.
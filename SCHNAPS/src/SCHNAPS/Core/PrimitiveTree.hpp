@@ -86,6 +86,16 @@ public:
 	const std::string& getReturnType(ExecutionContext& ioContext) const;
 	//! Validate the primitive tree.
 	void validate(ExecutionContext& ioContext) const;
+	//! Return true if the primitive tree always returns the same value, whatever the individual.
+	bool isInvariant(ExecutionContext& ioContext) const;
+	//! Return true if a primitive sub-tree always returns the same value, whatever the individual.
+	bool isInvariant(unsigned int inIndex, ExecutionContext& ioContext) const;
+	//! Return true if the primitive tree refers to a specific variable.
+	bool refersTo(const std::string& inReference) const;
+	//! Append the variables referred to by the primitives of tree to a list.
+	void listReferences(std::vector<std::string>& ioReferences) const;
+	//! Return the primitive tree written to a XML string.
+	std::string writeStr() const;
 
 private:
 	//! Read a primitive subtree from a XML subtree.
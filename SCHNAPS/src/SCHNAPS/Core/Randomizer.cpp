@@ -26,6 +26,7 @@
 
 #include "SCHNAPS/Core.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 using namespace SCHNAPS;
@@ -36,6 +37,162 @@ using namespace Core;
  *  \param inSeed Random number generator seed.
  */
 Randomizer::Randomizer(unsigned long inSeed) :
-	PACC::Randomizer(inSeed) {
+	PACC::Randomizer(inSeed),
+	mCounterBased(false)
+{
 	reset(inSeed);
+	setCounterBased(false);
+}
+
+/*!
+ *  \brief Compute the binary snapshot of a seed and a text state.
+ *  \param inSeed Seed (0 for a random seed).
+ *  \param inState Text state (empty to start from seed).
+ *  \param outState Snapshot to write.
+ *
+ *  Text states are only used in configuration files; they are converted once to binary snapshots when read.
+ */
+void Randomizer::parseState(unsigned long inSeed, const std::string& inState, State& outState) {
+	schnaps_StackTraceBeginM();
+	Randomizer lRandomizer(inSeed);
+	lRandomizer.reset(inSeed, inState);
+	lRandomizer.saveState(outState);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Randomizer::parseState(unsigned long, const std::string&, SCHNAPS::Core::Randomizer::State&)");
+}
+
+/*!
+ *  \brief Fill an array with floating-point numbers following a Gaussian distribution.
+ *  \param outValues Array to fill.
+ *  \param inSize Number of values to generate.
+ *  \param inMean Mean of the Gaussain distribution.
+ *  \param inStdDev Standard-error of the Gaussian distribution.
+ *
+ *  The values are the same as those of inSize successive calls to rollGaussian.
+ */
+void Randomizer::fillGaussian(double* outValues, unsigned int inSize, double inMean, double inStdDev) {
+	schnaps_StackTraceBeginM();
+	schnaps_AssertM(inStdDev >= 0.0);
+	if (mCounterBased == false) {
+		for (unsigned int i = 0; i < inSize; i++) {
+			outValues[i] = randNorm(inMean, inStdDev);
+		}
+		return;
+	}
+
+	unsigned int lStart = 0;
+	if (mHasGaussianSpare && inSize > 0) {
+		mHasGaussianSpare = false;
+		outValues[lStart++] = inMean + inStdDev * mGaussianSpare;
+	}
+
+	// Box-Muller transform of pairs of uniform numbers, in place
+	unsigned int lEnd = lStart + ((inSize - lStart) & ~1U);
+	fillUniform(outValues + lStart, lEnd - lStart);
+	double lRadius, lAngle;
+	for (unsigned int i = lStart; i < lEnd; i += 2) {
+		lRadius = std::sqrt(-2.0 * std::log(1.0 - outValues[i]));
+		lAngle = 6.283185307179586 * outValues[i + 1];
+		outValues[i] = inMean + inStdDev * (lRadius * std::cos(lAngle));
+		outValues[i + 1] = inMean + inStdDev * (lRadius * std::sin(lAngle));
+	}
+
+	// odd remainder keeps its pair for next draw
+	if (lEnd < inSize) {
+		outValues[lEnd] = inMean + inStdDev * drawNormal();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Randomizer::fillGaussian(double*, unsigned int, double, double)");
+}
+
+/*!
+ *  \brief Fill an array with numbers following a uniform distribution in the interval [inLower,inUpper).
+ *  \param outValues Array to fill.
+ *  \param inSize Number of values to generate.
+ *  \param inLower Lower bound of the uniform distribution.
+ *  \param inUpper Upper bound of the uniform distribution.
+ *
+ *  The values are the same as those of inSize successive calls to rollUniform.
+ */
+void Randomizer::fillUniform(double* outValues, unsigned int inSize, double inLower, double inUpper) {
+	schnaps_StackTraceBeginM();
+	schnaps_AssertM(inLower <= inUpper);
+	if (mCounterBased == false) {
+		for (unsigned int i = 0; i < inSize; i++) {
+			outValues[i] = getFloat(inLower, inUpper);
+		}
+		return;
+	}
+
+	double lRange = inUpper - inLower;
+	unsigned int lSize;
+	for (unsigned int i = 0; i < inSize; i += lSize) {
+		if (mBufferPosition == mBufferSize) {
+			refill((inSize - i + 1) / 2);
+		}
+		lSize = std::min((mBufferSize - mBufferPosition) / 2, inSize - i);
+		for (unsigned int j = 0; j < lSize; j++) {
+			outValues[i + j] = inLower + toUnit(mBuffer[mBufferPosition + 2 * j], mBuffer[mBufferPosition + 2 * j + 1]) * lRange;
+		}
+		mBufferPosition += 2 * lSize;
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::Randomizer::fillUniform(double*, unsigned int, double, double)");
+}
+
+/*!
+ *  \brief Compute the Philox4x32-10 blocks of consecutive draw counters and advance the draw counter.
+ *  \param outWords Computed blocks (four 32-bit words each).
+ *  \param inNbBlocks Number of blocks to compute (at most SCHNAPS_RANDOMIZER_BUFFER_BLOCKS).
+ *
+ *  Blocks are computed in separate lanes with no dependency between them, so that the compiler can vectorize the rounds.
+ */
+void Randomizer::drawBlocks(uint32_t* outWords, unsigned int inNbBlocks) {
+	uint32_t lX0[SCHNAPS_RANDOMIZER_BUFFER_BLOCKS];
+	uint32_t lX1[SCHNAPS_RANDOMIZER_BUFFER_BLOCKS];
+	uint32_t lX2[SCHNAPS_RANDOMIZER_BUFFER_BLOCKS];
+	uint32_t lX3[SCHNAPS_RANDOMIZER_BUFFER_BLOCKS];
+	uint32_t lKey0 = mKey[0];
+	uint32_t lKey1 = mKey[1];
+	unsigned long long lProduct0, lProduct1;
+	uint32_t lHigh0, lHigh1;
+
+	for (unsigned int j = 0; j < inNbBlocks; j++) {
+		lX0[j] = mCounter[0] + j;
+		lX1[j] = mCounter[1];
+		lX2[j] = mCounter[2];
+		lX3[j] = mCounter[3];
+	}
+	for (unsigned int i = 0; i < 10; i++) {
+		for (unsigned int j = 0; j < inNbBlocks; j++) {
+			lProduct0 = (unsigned long long) 0xD2511F53UL * lX0[j];
+			lProduct1 = (unsigned long long) 0xCD9E8D57UL * lX2[j];
+			lHigh0 = (uint32_t) (lProduct0 >> 32);
+			lHigh1 = (uint32_t) (lProduct1 >> 32);
+			lX0[j] = lHigh1 ^ lX1[j] ^ lKey0;
+			lX2[j] = lHigh0 ^ lX3[j] ^ lKey1;
+			lX1[j] = (uint32_t) lProduct1;
+			lX3[j] = (uint32_t) lProduct0;
+		}
+		lKey0 += 0x9E3779B9UL;
+		lKey1 += 0xBB67AE85UL;
+	}
+	for (unsigned int j = 0; j < inNbBlocks; j++) {
+		outWords[4 * j] = lX0[j];
+		outWords[4 * j + 1] = lX1[j];
+		outWords[4 * j + 2] = lX2[j];
+		outWords[4 * j + 3] = lX3[j];
+	}
+	mCounter[0] += inNbBlocks;
+}
+
+/*!
+ *  \brief Pre-generate blocks of the counter-based generator in the buffer.
+ *  \param inNbBlocks Number of blocks needed by the caller.
+ *
+ *  The number of generated blocks doubles at each refill of a stream, so that short streams stay cheap.
+ */
+void Randomizer::refill(unsigned int inNbBlocks) {
+	unsigned int lNbBlocks = std::min(std::max(inNbBlocks, mRefillBlocks), (unsigned int) SCHNAPS_RANDOMIZER_BUFFER_BLOCKS);
+	drawBlocks(mBuffer, lNbBlocks);
+	mBufferSize = 4 * lNbBlocks;
+	mBufferPosition = 0;
+	mRefillBlocks = std::min(2 * mRefillBlocks, (unsigned int) SCHNAPS_RANDOMIZER_BUFFER_BLOCKS);
 }
@@ -33,12 +33,28 @@
 
 #include "PACC/PACC.hpp"
 
+#include <cmath>
 #include <fstream>
 
+#ifdef SCHNAPS_HAVE_STDINT_H
+#include "stdint.h"
+#else // SCHNAPS_HAVE_STDINT_H
+#define uint32_t unsigned int
+#endif // SCHNAPS_HAVE_STDINT_H
+
 namespace SCHNAPS {
 	
 namespace Core {
 
+//! Stream index of counter-based draws that are not made for a specific individual.
+#define SCHNAPS_RANDOMIZER_GLOBAL_STREAM 0xFFFFFFFFUL
+//! Phase of counter-based draws made while generating individuals.
+#define SCHNAPS_RANDOMIZER_GENERATION_PHASE 0xFFFFFFFFUL
+//! Phase of counter-based draws made while generating contacts.
+#define SCHNAPS_RANDOMIZER_CONTACTS_PHASE 0xFFFFFFFEUL
+//! Maximum number of counter-based blocks generated at once in the buffer of a randomizer.
+#define SCHNAPS_RANDOMIZER_BUFFER_BLOCKS 64
+
 // forward declaration
 class System;
 
@@ -46,6 +62,10 @@ class System;
  *  \class Randomizer SCHNAPS/Core/Randomizer.hpp "SCHNAPS/Core/Randomizer.hpp"
  *  \brief Random number generator class.
  *  \note  The operator() allow compliance with the STL random number generator interface.
+ *
+ *  Draws come from the Mersenne Twister by default. In counter-based mode, each draw is the
+ *  Philox4x32-10 block of (key, phase, individual index, clock tick, draw counter), so the values
+ *  drawn for an individual do not depend on the number of threads nor on the thread processing it.
  */
 class Randomizer: public Object, public PACC::Randomizer {
 public:
@@ -56,6 +76,15 @@ public:
 	//! Randomizer bag type.
 	typedef ContainerT<Randomizer, Object::Bag> Bag;
 
+	/*!
+	 * \struct State SCHNAPS/Core/Randomizer.hpp "SCHNAPS/Core/Randomizer.hpp"
+	 * \brief  Binary snapshot of the seed and Mersenne Twister state of a randomizer.
+	 */
+	struct State {
+		unsigned long mSeed;					//!< Seed used to initialize the random number generator.
+		MTRand::uint32 mWords[MTRand::SAVE];	//!< Mersenne Twister state.
+	};
+
 	explicit Randomizer(unsigned long inSeed = 0);
 	virtual ~Randomizer() {}
 
@@ -92,6 +121,71 @@ public:
 		return mSeed;
 	}
 
+	/*!
+	 * \brief Save the seed and state of the random generator in a binary snapshot.
+	 * \param outState Snapshot to write.
+	 */
+	void saveState(State& outState) const {
+		outState.mSeed = mSeed;
+		save(outState.mWords);
+	}
+
+	/*!
+	 * \brief Restore the seed and state of the random generator from a binary snapshot.
+	 * \param inState Snapshot to read.
+	 */
+	void loadState(const State& inState) {
+		mSeed = inState.mSeed;
+		load(const_cast<MTRand::uint32*>(inState.mWords));
+	}
+
+	static void parseState(unsigned long inSeed, const std::string& inState, State& outState);
+
+	/*!
+	 * \brief Switch between the Mersenne Twister and the counter-based generator.
+	 * \param inCounterBased True to draw from the counter-based generator.
+	 * \param inKey Key of the counter-based generator, which must be the same for all threads.
+	 */
+	void setCounterBased(bool inCounterBased, unsigned long inKey = 0) {
+		mCounterBased = inCounterBased;
+		mKey[0] = (uint32_t) inKey;
+		mKey[1] = (uint32_t) ((inKey >> 16) >> 16);
+		setStream(SCHNAPS_RANDOMIZER_GLOBAL_STREAM, 0);
+	}
+
+	/*!
+	 * \brief  Return true if draws come from the counter-based generator.
+	 * \return True if draws come from the counter-based generator.
+	 */
+	bool isCounterBased() const {
+		return mCounterBased;
+	}
+
+	/*!
+	 * \brief  Return the key of the counter-based generator.
+	 * \return The key of the counter-based generator.
+	 */
+	unsigned long getCounterKey() const {
+		return (((unsigned long) mKey[1] << 16) << 16) | mKey[0];
+	}
+
+	/*!
+	 * \brief Select the stream of the counter-based generator and restart its draw counter.
+	 * \param inIndex Index of the individual that draws (SCHNAPS_RANDOMIZER_GLOBAL_STREAM if none).
+	 * \param inTick Current clock tick.
+	 * \param inPhase Phase of the time step (sub-step number, or a reserved generation phase).
+	 */
+	void setStream(unsigned long inIndex, unsigned long inTick, unsigned long inPhase = 0) {
+		mCounter[0] = 0;
+		mCounter[1] = (uint32_t) inPhase;
+		mCounter[2] = (uint32_t) inIndex;
+		mCounter[3] = (uint32_t) inTick;
+		mBufferSize = 0;
+		mBufferPosition = 0;
+		mRefillBlocks = 1;
+		mHasGaussianSpare = false;
+	}
+
 	/*!
 	 *  \brief Generate a floating-point number following a Gaussian distribution.
 	 *  \param inMean Mean of the Gaussain distribution.
@@ -100,6 +194,9 @@ public:
 	double rollGaussian(double inMean = 0.0, double inStdDev = 1.0) {
 		schnaps_StackTraceBeginM();
 		schnaps_AssertM(inStdDev >= 0.0);
+		if (mCounterBased) {
+			return inMean + inStdDev * drawNormal();
+		}
 		return randNorm(inMean, inStdDev);
 		schnaps_StackTraceEndM("double Randomizer::rollGaussian(double, double)");
 	}
@@ -113,6 +210,19 @@ public:
 	unsigned long rollInteger(unsigned long inLower = 0, unsigned long inUpper = ULONG_MAX) {
 		schnaps_StackTraceBeginM();
 		schnaps_AssertM(inLower <= inUpper);
+		if (mCounterBased) {
+			unsigned long lRange = inUpper - inLower;
+			unsigned long lValue = drawULong();
+			if (lRange == ULONG_MAX) {
+				return lValue;
+			}
+			// reject values of the last incomplete interval so that all integers are equiprobable
+			unsigned long lLimit = ULONG_MAX - (ULONG_MAX % (lRange + 1) + 1) % (lRange + 1);
+			while (lValue > lLimit) {
+				lValue = drawULong();
+			}
+			return lValue % (lRange + 1) + inLower;
+		}
 		return randInt(inUpper - inLower) + inLower;
 		schnaps_StackTraceEndM("unsigned long Randomizer::rollInteger(unsigned long, unsigned long)");
 	}
@@ -126,12 +236,93 @@ public:
 	double rollUniform(double inLower = 0.0, double inUpper = 1.0) {
 		schnaps_StackTraceBeginM();
 		schnaps_AssertM(inLower <= inUpper);
+		if (mCounterBased) {
+			return inLower + drawUnit() * (inUpper - inLower);
+		}
 		return getFloat(inLower, inUpper);
 		schnaps_StackTraceEndM("double Randomizer::rollUniform(double, double)");
 	}
 
+	void fillGaussian(double* outValues, unsigned int inSize, double inMean = 0.0, double inStdDev = 1.0);
+	void fillUniform(double* outValues, unsigned int inSize, double inLower = 0.0, double inUpper = 1.0);
+
 protected:
-	unsigned long mSeed; //!< Seed used to initialize the random number generator.
+	void drawBlocks(uint32_t* outWords, unsigned int inNbBlocks);
+	void refill(unsigned int inNbBlocks);
+
+	/*!
+	 * \brief  Draw a number in [0,1) from the buffer of the counter-based generator.
+	 * \return Number in [0,1).
+	 */
+	double drawUnit() {
+		if (mBufferPosition == mBufferSize) {
+			refill(1);
+		}
+		mBufferPosition += 2;
+		return toUnit(mBuffer[mBufferPosition - 2], mBuffer[mBufferPosition - 1]);
+	}
+
+	/*!
+	 * \brief  Draw an unsigned long from the buffer of the counter-based generator.
+	 * \return Unsigned long.
+	 */
+	unsigned long drawULong() {
+		if (mBufferPosition == mBufferSize) {
+			refill(1);
+		}
+		mBufferPosition += 2;
+		return toULong(mBuffer[mBufferPosition - 2], mBuffer[mBufferPosition - 1]);
+	}
+
+	/*!
+	 * \brief  Draw a standard normal number from the counter-based generator.
+	 * \return Standard normal number.
+	 *
+	 * The Box-Muller transform gives two numbers for two uniform numbers; the second one is kept for next draw.
+	 */
+	double drawNormal() {
+		if (mHasGaussianSpare) {
+			mHasGaussianSpare = false;
+			return mGaussianSpare;
+		}
+		double lRadius = std::sqrt(-2.0 * std::log(1.0 - drawUnit()));
+		double lAngle = 6.283185307179586 * drawUnit();
+		mGaussianSpare = lRadius * std::sin(lAngle);
+		mHasGaussianSpare = true;
+		return lRadius * std::cos(lAngle);
+	}
+
+	/*!
+	 * \brief  Convert two 32-bit words into a number in [0,1) with 53 bits of precision.
+	 * \param  inHigh Most significant word.
+	 * \param  inLow Least significant word.
+	 * \return Number in [0,1).
+	 */
+	static double toUnit(uint32_t inHigh, uint32_t inLow) {
+		return ((inHigh >> 5) * 67108864.0 + (inLow >> 6)) * (1.0 / 9007199254740992.0);
+	}
+
+	/*!
+	 * \brief  Convert two 32-bit words into an unsigned long (only the low word is kept if unsigned long is 32 bits).
+	 * \param  inHigh Most significant word.
+	 * \param  inLow Least significant word.
+	 * \return Unsigned long made of the words.
+	 */
+	static unsigned long toULong(uint32_t inHigh, uint32_t inLow) {
+		return ((((unsigned long) inHigh) << 16) << 16) | inLow;
+	}
+
+	unsigned long mSeed;	//!< Seed used to initialize the random number generator.
+	bool mCounterBased;		//!< True if draws come from the counter-based generator.
+	uint32_t mKey[2];		//!< Key of the counter-based generator.
+	uint32_t mCounter[4];	//!< Counter of the counter-based generator (draw counter, phase, individual index, clock tick).
+
+	uint32_t mBuffer[4 * SCHNAPS_RANDOMIZER_BUFFER_BLOCKS];	//!< Pre-generated words of the counter-based generator.
+	unsigned int mBufferSize;								//!< Number of pre-generated words.
+	unsigned int mBufferPosition;							//!< Position of next word to use.
+	unsigned int mRefillBlocks;								//!< Number of blocks generated at next refill (doubled at each refill of a stream).
+	double mGaussianSpare;									//!< Second standard normal number of last Box-Muller transform.
+	bool mHasGaussianSpare;									//!< True if the second standard normal number has not been used.
 };
 } // end of Core namespace
 } // end of SCHNAPS namespace
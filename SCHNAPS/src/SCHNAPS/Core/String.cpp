@@ -115,3 +115,13 @@ AnyType::Handle String::clone() const {
 	return new String(*this);
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::String::clone() const");
 }
+
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void String::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const String&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::String::copyValue(const SCHNAPS::Core::AnyType&)");
+}
@@ -81,12 +81,23 @@ void System::read(PACC::XML::ConstIterator inIter) {
  * \brief Write object content to XML.
  * \param ioStreamer XML streamer to output document.
  * \param inIndent Wether to indent or not.
+ *
+ * Plugins and parameters are written first, so that the written system can be read back.
  */
 void System::writeContent(PACC::XML::Streamer& outStreamer, bool inIndent) const {
 	schnaps_StackTraceBeginM();
+	// plugins and parameters first, as reading other components may require them
+	if (find("Plugins") != end()) {
+		getComponent("Plugins").write(outStreamer, inIndent);
+	}
+	if (find("Parameters") != end()) {
+		getComponent("Parameters").write(outStreamer, inIndent);
+	}
 	for (System::const_iterator lItr = begin(); lItr != end(); ++lItr) {
-		const Component::Handle lComponent = castHandleT<const Component>(lItr->second);
-		lComponent->write(outStreamer, inIndent);
+		if (lItr->first != "Plugins" && lItr->first != "Parameters") {
+			const Component::Handle lComponent = castHandleT<const Component>(lItr->second);
+			lComponent->write(outStreamer, inIndent);
+		}
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Core::System::writeContent(PACC::XML::Streamer&, bool) const");
 }
@@ -150,3 +161,15 @@ void System::initComponents() {
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Core::System::initComponents()");
 }
+
+/*!
+*  \brief Reset the components of system before a simulation.
+ */
+void System::resetComponents() {
+	schnaps_StackTraceBeginM();
+	for (iterator lItr = begin(); lItr != end(); ++lItr) {
+		Component::Handle lComponent = castHandleT<Component>(lItr->second);
+		lComponent->reset(*this);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Core::System::resetComponents()");
+}
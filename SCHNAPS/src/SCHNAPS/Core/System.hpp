@@ -100,6 +100,8 @@ public:
 	void addComponent(Component::Handle inComponent);
 	//! Initialize the components of this system.
 	void initComponents();
+	//! Reset the components of this system before a simulation.
+	void resetComponents();
 
 	/*!
 	 * \brief Return a const reference to the factory.
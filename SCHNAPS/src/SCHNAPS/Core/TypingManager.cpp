@@ -35,6 +35,7 @@ TypingManager::TypingManager() :
 	// basic types
 	mTypeMap["Atom"].push_back("Any");
 	mTypeMap["Vector"].push_back("Any");
+	mTypeMap["ContactList"].push_back("Any");
 	mTypeMap["Void"].push_back("Any");
 
 	// atom types
@@ -118,6 +118,16 @@ AnyType::Handle UInt::clone() const {
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Core::UInt::clone() const");
 }
 
+/*!
+ * \brief Set the value to the value of another object of same type.
+ * \param inOriginal A const reference to the original object.
+ */
+void UInt::copyValue(const AnyType& inOriginal) {
+	schnaps_StackTraceBeginM();
+	*this = castObjectT<const UInt&>(inOriginal);
+	schnaps_StackTraceEndM("void SCHNAPS::Core::UInt::copyValue(const SCHNAPS::Core::AnyType&)");
+}
+
 /*!
  * \brief  Compute the absolute value.
  * \return A handle to the resulting number.
@@ -23,6 +23,7 @@
 
 // framework
 #include "SCHNAPS/Simulation/State.hpp"
+#include "SCHNAPS/Simulation/MappedFile.hpp"
 #include "SCHNAPS/Simulation/Environment.hpp"
 #include "SCHNAPS/Simulation/Individual.hpp"
 #include "SCHNAPS/Simulation/Population.hpp"
@@ -33,6 +34,7 @@
 #include "SCHNAPS/Simulation/ProcessPushed.hpp"
 #include "SCHNAPS/Simulation/BlackBoard.hpp"
 #include "SCHNAPS/Simulation/WaitingQMaps.hpp"
+#include "SCHNAPS/Simulation/ObserverSchedule.hpp"
 #include "SCHNAPS/Simulation/SimulationContext.hpp"
 
 // population generation
@@ -46,6 +48,7 @@
 // multi-Threading
 #include "SCHNAPS/Simulation/SimulationThread.hpp"
 #include "SCHNAPS/Simulation/GenerationThread.hpp"
+#include "SCHNAPS/Simulation/ParsingThread.hpp"
 
 #include "SCHNAPS/Simulation/Simulator.hpp"
 
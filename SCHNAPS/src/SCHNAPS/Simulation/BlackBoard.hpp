@@ -26,6 +26,7 @@
 
 #include <list>
 #include <map>
+#include <vector>
 
 namespace SCHNAPS {
 namespace Simulation {
@@ -39,6 +40,7 @@ struct Push {
 	Process::Target mTarget;	//!< The target of the push.
 	unsigned long mTime;		//!< The time step of process execution.
 	unsigned long mTargetID;		//!< The individual ID in case the process is pushed to a specific individual
+	std::vector<unsigned int> mTargetIDs;	//!< The individual IDs in case the process is pushed to a batch of specific individuals (replaces mTargetID when not empty)
 
 	/*!
 	 * \brief Construct a push as a copy of an original.
@@ -48,7 +50,8 @@ struct Push {
 		mProcess(inOriginal.mProcess.c_str()),
 		mTarget(inOriginal.mTarget),
 		mTime(inOriginal.mTime),
-		mTargetID(inOriginal.mTargetID)
+		mTargetID(inOriginal.mTargetID),
+		mTargetIDs(inOriginal.mTargetIDs)
 	{}
 	/*!
 	 * \brief Construct a push with specific process, target, time and ID.
@@ -63,6 +66,19 @@ struct Push {
 		mTime(inTime),
 		mTargetID(inTargetID)
 	{}
+	/*!
+	 * \brief Construct a push of a process toward a batch of specific individuals at a specific time.
+	 * \param inProcess A const reference to the name of the process pushed.
+	 * \param inTime The time step of process execution.
+	 * \param inTargetIDs The individual IDs to push the process on.
+	 */
+	Push(const std::string& inProcess, unsigned long inTime, const std::vector<unsigned int>& inTargetIDs) :
+		mProcess(inProcess.c_str()),
+		mTarget(Process::eIndividualByID),
+		mTime(inTime),
+		mTargetID(0),
+		mTargetIDs(inTargetIDs)
+	{}
 
 };
 
@@ -86,6 +86,27 @@ public:
 		schnaps_StackTraceEndM("bool SCHNAPS::Simulation::Clock::step(SCHNAPS::Core::ExecutionContext&)");
 	}
 
+	/*!
+	 * \brief  Have the clock stepping up to a specific value, evaluating the stop condition at each intermediate tick.
+	 * \param  inValue The clock value to reach.
+	 * \param  ioContext A reference to the execution context.
+	 * \return True if the simulation continues, false if the stop condition was encountered on the way.
+	 *
+	 * This is equivalent to repeated calls to step() when nothing happens before the given value.
+	 */
+	bool stepTo(unsigned long inValue, Core::ExecutionContext& ioContext) {
+		schnaps_StackTraceBeginM();
+		schnaps_NonNullPointerAssertM(mStop);
+		do {
+			mValue++;
+			if (Core::castHandleT<Core::Bool>(mStop->interpret(ioContext))->getValue()) {
+				return false;
+			}
+		} while (mValue < inValue);
+		return true;
+		schnaps_StackTraceEndM("bool SCHNAPS::Simulation::Clock::stepTo(unsigned long, SCHNAPS::Core::ExecutionContext&)");
+	}
+
 	/*!
 	 * \brief  Return the current value in specific units.
 	 * \param  inUnits The specific units in which to return the clock value.
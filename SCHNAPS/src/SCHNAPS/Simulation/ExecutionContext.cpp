@@ -31,7 +31,9 @@ ExecutionContext::ExecutionContext() :
 		Core::ExecutionContext(),
 		mClock(NULL),
 		mEnvironment(NULL),
-		mIndividual(NULL)
+		mIndividual(NULL),
+		mLocalFrames(1),
+		mLocalDepth(1)
 {}
 
 /*!
@@ -43,7 +45,8 @@ ExecutionContext::ExecutionContext(const ExecutionContext& inOriginal) :
 		mClock(inOriginal.mClock),
 		mEnvironment(inOriginal.mEnvironment),
 		mIndividual(inOriginal.mIndividual),
-		mLocalVariables(inOriginal.mLocalVariables)
+		mLocalFrames(inOriginal.mLocalFrames),
+		mLocalDepth(inOriginal.mLocalDepth)
 {}
 
 /*!
@@ -56,32 +59,102 @@ ExecutionContext::ExecutionContext(const Core::System::Handle inSystem, const Cl
 		Core::ExecutionContext(inSystem),
 		mClock(inClock),
 		mEnvironment(inEnvironment),
-		mIndividual(NULL)
+		mIndividual(NULL),
+		mLocalFrames(1),
+		mLocalDepth(1)
 {}
 
 /*!
  * \brief Erase all local variables.
+ *
+ * All frames are popped, but they stay allocated for next calls.
  */
 void ExecutionContext::clearLocalVariables() {
 	schnaps_StackTraceBeginM();
-	mLocalVariables.clear();
+	mLocalDepth = 1;
+	mLocalFrames[0].mLabels = NULL;
+	mLocalFrames[0].mInsertedLabels.clear();
+	mLocalFrames[0].mValues.clear();
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::clearLocalVariables()");
 }
 
 /*!
- * \brief Insert a local variable.
+ * \brief Insert a local variable in the current frame.
  * \param inLabel A const reference to the label of the local variable.
  * \param inValue A handle to the value of the local variable.
- * \throw SCHNAPS::Core::RunTimeException if the local variable already exists.
+ * \throw SCHNAPS::Core::RunTimeException if the local variable already exists in the current frame.
  */
 void ExecutionContext::insertLocalVariable(const std::string& inLabel, Core::AnyType::Handle inValue) {
 	schnaps_StackTraceBeginM();
-	if (mLocalVariables.find(inLabel) != mLocalVariables.end()) {
-		std::ostringstream lOSS;
-		lOSS << "The local variable '" << inLabel << "' already exists; ";
-		lOSS << "could not insert it.";
-		throw schnaps_RunTimeExceptionM(lOSS.str());
+	LocalFrame& lFrame = mLocalFrames[mLocalDepth-1];
+	const std::vector<std::string>& lLabels = lFrame.getLabels();
+	for (unsigned int i = 0; i < lLabels.size(); i++) {
+		if (lLabels[i] == inLabel) {
+			std::ostringstream lOSS;
+			lOSS << "The local variable '" << inLabel << "' already exists; ";
+			lOSS << "could not insert it.";
+			throw schnaps_RunTimeExceptionM(lOSS.str());
+		}
+	}
+	if (lFrame.mLabels != NULL) {
+		// labels resolved at load time are not owned by frame
+		lFrame.mInsertedLabels.assign(lFrame.mLabels->begin(), lFrame.mLabels->end());
+		lFrame.mLabels = NULL;
 	}
-	mLocalVariables.insert(std::pair<std::string, Core::AnyType::Handle>(inLabel.c_str(), inValue));
+	lFrame.mInsertedLabels.push_back(inLabel);
+	lFrame.mValues.push_back(inValue);
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::insertLocalVariable(const std::string&, SCHNAPS::Core::Atom::Handle) const");
 }
+
+/*!
+ * \brief  Push a frame of local variables whose labels are resolved at load time.
+ * \param  inLabels A const reference to the labels of local variables (must outlive the frame).
+ * \return A reference to the values of local variables, one slot per label, to be set by caller.
+ *
+ * Frames are kept allocated once popped, so that calls at the same depth reuse them.
+ */
+std::vector<Core::AnyType::Handle>& ExecutionContext::pushLocalFrame(const std::vector<std::string>& inLabels) {
+	schnaps_StackTraceBeginM();
+	if (mLocalDepth == mLocalFrames.size()) {
+		mLocalFrames.push_back(LocalFrame());
+	}
+	LocalFrame& lFrame = mLocalFrames[mLocalDepth++];
+	lFrame.mLabels = &inLabels;
+	lFrame.mInsertedLabels.clear();
+	lFrame.mValues.resize(inLabels.size());
+	return lFrame.mValues;
+	schnaps_StackTraceEndM("std::vector<SCHNAPS::Core::AnyType::Handle>& SCHNAPS::Simulation::ExecutionContext::pushLocalFrame(const std::vector<std::string>&)");
+}
+
+/*!
+ * \brief Push an empty frame of local variables.
+ *
+ * Local variables are then inserted in the frame one by one (see insertLocalVariable).
+ */
+void ExecutionContext::pushLocalFrame() {
+	schnaps_StackTraceBeginM();
+	if (mLocalDepth == mLocalFrames.size()) {
+		mLocalFrames.push_back(LocalFrame());
+	}
+	LocalFrame& lFrame = mLocalFrames[mLocalDepth++];
+	lFrame.mLabels = NULL;
+	lFrame.mInsertedLabels.clear();
+	lFrame.mValues.clear();
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::pushLocalFrame()");
+}
+
+/*!
+ * \brief Replace the local variables by clones of the local variables of another context.
+ * \param inOriginal A const reference to the original context.
+ */
+void ExecutionContext::cloneLocalVariables(const ExecutionContext& inOriginal) {
+	schnaps_StackTraceBeginM();
+	mLocalFrames.assign(inOriginal.mLocalFrames.begin(), inOriginal.mLocalFrames.begin()+inOriginal.mLocalDepth);
+	mLocalDepth = inOriginal.mLocalDepth;
+	for (unsigned int i = 0; i < mLocalFrames.size(); i++) {
+		for (unsigned int j = 0; j < mLocalFrames[i].mValues.size(); j++) {
+			mLocalFrames[i].mValues[j] = Core::castHandleT<Core::AnyType>(mLocalFrames[i].mValues[j]->clone());
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::cloneLocalVariables(const SCHNAPS::Simulation::ExecutionContext&)");
+}
@@ -28,13 +28,8 @@
 
 #include "SCHNAPS/Core/HashString.hpp"
 
-#if defined(SCHNAPS_HAVE_STD_HASHMAP) | defined(SCHNAPS_HAVE_STDEXT_HASHMAP)
-#include <hash_map>
-#elif defined(SCHNAPS_HAVE_GNUCXX_HASHMAP)
-#include <tr1/unordered_map>
-#else
-#include <map>
-#endif
+#include <string>
+#include <vector>
 
 namespace SCHNAPS {
 namespace Simulation {
@@ -45,16 +40,6 @@ namespace Simulation {
  */
 class ExecutionContext: public Core::ExecutionContext {
 public:
-#if defined(SCHNAPS_HAVE_STD_HASHMAP)
-	typedef std::hash_map<std::string, Core::AnyType::Handle, Core::HashString> LocalVariablesMap;
-#elif defined(SCHNAPS_HAVE_GNUCXX_HASHMAP)
-	typedef std::tr1::unordered_map<std::string, Core::AnyType::Handle, Core::HashString> LocalVariablesMap;
-#elif defined(SCHNAPS_HAVE_STDEXT_HASHMAP)
-	typedef stdext::hash_map<std::string, Core::AnyType::Handle, Core::HashString> LocalVariablesMap;
-#else // no hash_map found
-	typedef std::map<std::string, Core::AnyType::Handle> LocalVariablesMap;
-#endif
-
 	//! ExecutionContext allocator type.
 	typedef Core::AllocatorT<ExecutionContext, Core::ExecutionContext::Alloc> Alloc;
 	//! ExecutionContext handle type.
@@ -168,9 +153,25 @@ public:
 	
 	//! Erase all local variables.
 	void clearLocalVariables();
-	//! Insert a local variable.
+	//! Insert a local variable in the current frame.
 	void insertLocalVariable(const std::string& inLabel, Core::AnyType::Handle inValue);
 	
+	//! Push a frame of local variables whose labels are resolved at load time.
+	std::vector<Core::AnyType::Handle>& pushLocalFrame(const std::vector<std::string>& inLabels);
+	//! Push an empty frame of local variables.
+	void pushLocalFrame();
+	
+	/*!
+	 * \brief Pop the current frame of local variables.
+	 * \throw SCHNAPS::Core::AssertException if there is no frame to pop.
+	 */
+	void popLocalFrame() {
+		schnaps_StackTraceBeginM();
+		schnaps_AssertM(mLocalDepth > 1);
+		mLocalDepth--;
+		schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::popLocalFrame()");
+	}
+	
 	/*!
 	 * \brief Set a local variable.
 	 * \param inLabel A const reference to the label of the local variable.
@@ -179,29 +180,19 @@ public:
 	 */
 	void setLocalVariable(const std::string& inLabel, Core::AnyType::Handle inValue) {
 		schnaps_StackTraceBeginM();
-		LocalVariablesMap::iterator lIter = mLocalVariables.find(inLabel);
-		if (lIter == mLocalVariables.end()) {
+		Core::AnyType::Handle* lVariable = findLocalVariable(inLabel);
+		if (lVariable == NULL) {
 			std::ostringstream lOSS;
 			lOSS << "The local variable '" << inLabel << "' does not exists; ";
 			lOSS << "could not set it.";
 			throw schnaps_RunTimeExceptionM(lOSS.str());
 		}
 		// TODO: remove full assign?
-		//lIter->second = inValue;
-		lIter->second->readStr(inValue->writeStr());
+		//*lVariable = inValue;
+		(*lVariable)->readStr(inValue->writeStr());
 		schnaps_StackTraceEndM("void SCHNAPS::Simulation::ExecutionContext::setLocalVariable(const std::string&, SCHNAPS::Core::Atom::Handle) const");
 	}
 	
-	/*!
-	 * \brief  Return a copy of the local variables container.
-	 * \return A copy of the local variables container.
-	 */
-	LocalVariablesMap getLocalVariables() const {
-		schnaps_StackTraceBeginM();
-		return mLocalVariables;
-		schnaps_StackTraceEndM("LocalVariablesMap SCHNAPS::Simulation::ExecutionContext::getLocalVariables() const");
-	}
-	
 	/*!
 	 * \brief  Return a const reference to the value of a local variable.
 	 * \param  inLabel A const reference to the label of the local variable.
@@ -211,15 +202,15 @@ public:
 	 */
 	const Core::AnyType& getLocalVariable(const std::string& inLabel) const {
 		schnaps_StackTraceBeginM();
-		LocalVariablesMap::const_iterator lIterVariables = mLocalVariables.find(inLabel);
-		if (lIterVariables == mLocalVariables.end()) {
+		const Core::AnyType::Handle* lVariable = findLocalVariable(inLabel);
+		if (lVariable == NULL) {
 			std::ostringstream lOSS;
 			lOSS << "The local variable '" << inLabel << "' does not exist; ";
 			lOSS << "could not get it.";
 			throw schnaps_RunTimeExceptionM(lOSS.str());
 		}
-		schnaps_NonNullPointerAssertM(lIterVariables->second);
-		return *lIterVariables->second;
+		schnaps_NonNullPointerAssertM(*lVariable);
+		return **lVariable;
 		schnaps_StackTraceEndM("const SCHNAPS::Core::AnyType& SCHNAPS::Simulation::ExecutionContext::getLocalVariable(const std::string&) const");
 	}
 	
@@ -231,17 +222,64 @@ public:
 	 */
 	const Core::AnyType::Handle getLocalVariableHandle(const std::string& inLabel) const {
 		schnaps_StackTraceBeginM();
-		LocalVariablesMap::const_iterator lIterVariables = mLocalVariables.find(inLabel);
-		if (lIterVariables == mLocalVariables.end()) {
+		const Core::AnyType::Handle* lVariable = findLocalVariable(inLabel);
+		if (lVariable == NULL) {
 			std::ostringstream lOSS;
 			lOSS << "The local variable '" << inLabel << "' does not exist; ";
 			lOSS << "could not get it.";
 			throw schnaps_RunTimeExceptionM(lOSS.str());
 		}
-		return lIterVariables->second;
+		return *lVariable;
 		schnaps_StackTraceEndM("const SCHNAPS::Core::AnyType::Handle SCHNAPS::Simulation::ExecutionContext::getVariableHandle(const std::string&) const");
 	}
 
+protected:
+	/*!
+	 * \struct LocalFrame SCHNAPS/Simulation/ExecutionContext.hpp "SCHNAPS/Simulation/ExecutionContext.hpp"
+	 * \brief  Local variables of a process call, one slot per variable.
+	 */
+	struct LocalFrame {
+		const std::vector<std::string>* mLabels;		//!< Labels of slots resolved at load time (NULL if variables are inserted).
+		std::vector<std::string> mInsertedLabels;		//!< Labels of slots inserted one by one.
+		std::vector<Core::AnyType::Handle> mValues;		//!< Values of local variables, per slot.
+		
+		LocalFrame() : mLabels(NULL) {}
+		
+		//! Return a const reference to the labels of slots.
+		const std::vector<std::string>& getLabels() const {
+			return mLabels == NULL ? mInsertedLabels : *mLabels;
+		}
+	};
+	
+	//! Replace the local variables by clones of the local variables of another context.
+	void cloneLocalVariables(const ExecutionContext& inOriginal);
+
+	/*!
+	 * \brief  Return a pointer to the value of a local variable, looking from the current frame down to the first.
+	 * \param  inLabel A const reference to the label of the local variable.
+	 * \return A pointer to the handle of the value, or NULL if the local variable does not exist.
+	 */
+	Core::AnyType::Handle* findLocalVariable(const std::string& inLabel) {
+		for (unsigned int i = mLocalDepth; i > 0; i--) {
+			const std::vector<std::string>& lLabels = mLocalFrames[i-1].getLabels();
+			for (unsigned int j = 0; j < lLabels.size(); j++) {
+				if (lLabels[j] == inLabel) {
+					return &mLocalFrames[i-1].mValues[j];
+				}
+			}
+		}
+		return NULL;
+	}
+	
+	/*!
+	 * \brief  Return a const pointer to the value of a local variable, looking from the current frame down to the first.
+	 * \param  inLabel A const reference to the label of the local variable.
+	 * \return A const pointer to the handle of the value, or NULL if the local variable does not exist.
+	 */
+	const Core::AnyType::Handle* findLocalVariable(const std::string& inLabel) const {
+		return const_cast<ExecutionContext*>(this)->findLocalVariable(inLabel);
+	}
+
 protected:
 	// reference structures
 	Clock::Handle mClock;				//!< A handle to the clock used for simulation.
@@ -249,7 +287,8 @@ protected:
 
 	// current structures
 	Individual::Handle mIndividual;		//!< A handle to the current individual (or environment) processing.
-	LocalVariablesMap mLocalVariables;	//!< Current local variables in the executing process.
+	std::vector<LocalFrame> mLocalFrames;	//!< Frames of local variables (kept allocated between calls).
+	unsigned int mLocalDepth;				//!< Number of frames in use (the first one is always in use).
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
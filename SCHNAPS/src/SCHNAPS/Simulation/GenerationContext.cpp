@@ -73,15 +73,11 @@ GenerationContext::Handle GenerationContext::deepCopy() const {
 	schnaps_StackTraceBeginM();
 	GenerationContext::Handle lCopy = new GenerationContext(mSystem, mClock, mEnvironment);
 
-	// set profile as a copy of the current one
-	lCopy->setGenProfile(Core::castHandleT<GenProfile>(mGenProfile->deepCopy(*mSystem)));
+	// share profile (read-only)
+	lCopy->setGenProfile(mGenProfile);
 	
 	// copy local variables
-	for (LocalVariablesMap::const_iterator lIt = this->mLocalVariables.begin(); lIt != this->mLocalVariables.end(); lIt++) {
-		lCopy->mLocalVariables.insert(std::pair<std::string, Core::AnyType::Handle>(
-			lIt->first.c_str(),
-			Core::castHandleT<Core::AnyType>(lIt->second->clone())));
-	}
+	lCopy->cloneLocalVariables(*this);
 
 	return lCopy;
 	schnaps_StackTraceEndM("SCHNAPS::Simulation::GenerationContext& SCHNAPS::Simulation::GenerationContext::operator=(const SCHNAPS::Simulation::GenerationContext&)");
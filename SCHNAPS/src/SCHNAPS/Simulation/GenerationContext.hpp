@@ -84,7 +84,7 @@ public:
 
 protected:
 	// data structures
-	GenProfile::Handle mGenProfile;	//!< A handle to the profile from which individuals are created.
+	GenProfile::Handle mGenProfile;	//!< A handle to the profile from which individuals are created (shared read-only by contexts).
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
@@ -30,6 +30,7 @@ GenerationThread::GenerationThread(PACC::Threading::Condition* inParallel,
 		mParallel(inParallel),
 		mSequential(inSequential),
 		mContext(inContext),
+		mBlockSize(0),
 		mIndividuals(new Individual::Bag())
 {
 	run();
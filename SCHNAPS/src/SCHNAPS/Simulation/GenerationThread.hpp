@@ -23,6 +23,7 @@
 
 #include "PACC/PACC.hpp"
 
+#include "SCHNAPS/Core/Bool.hpp"
 #include "SCHNAPS/Core/String.hpp"
 #include "SCHNAPS/Simulation/GenerationContext.hpp"
 
@@ -54,6 +55,11 @@ public:
 		mEraseVariables = inEraseVariables;
 	}
 
+	void setBatchInfo(unsigned int inBlockSize, Core::BoolArray::Handle inResampleVariables) {
+		mBlockSize = inBlockSize;
+		mResampleVariables = inResampleVariables;
+	}
+
 	GenerationContext::Handle getContextHandle() {
 		return mContext;
 	}
@@ -75,6 +81,15 @@ public:
 		return *mEraseVariables;
 	}
 
+	const unsigned int getBlockSize() const {
+		return mBlockSize;
+	}
+
+	const Core::BoolArray& getResampleVariables() const {
+		schnaps_NonNullPointerAssertM(mResampleVariables);
+		return *mResampleVariables;
+	}
+
 	Individual::Bag& getIndividuals() {
 		schnaps_NonNullPointerAssertM(mIndividuals);
 		return *mIndividuals;
@@ -96,6 +111,8 @@ private:
 	std::string mPrefix;						//!< Individual ID prefix.
 	unsigned int mStartingIndex;				//!< First individual index (concatenate with prefix to get ID).
 	Core::StringArray::Handle mEraseVariables;	//!< Individual variables to erase.
+	unsigned int mBlockSize;					//!< Size of blocks of individuals generated together (0 for one individual at a time).
+	Core::BoolArray::Handle mResampleVariables;	//!< Demography variables to re-sample when an individual is rejected.
 
 	// Result
 	Individual::Bag::Handle mIndividuals;
@@ -21,6 +21,7 @@
 #include "SCHNAPS/Core.hpp"
 #include "SCHNAPS/Simulation.hpp"
 
+#include <algorithm>
 #include <vector>
 
 using namespace SCHNAPS;
@@ -47,13 +48,13 @@ Generator::Generator(const Generator& inOriginal) :
 	mEnvironment(inOriginal.mEnvironment),
 	mRandomizerInitSeed(inOriginal.mRandomizerInitSeed),
 	mRandomizerInitState(inOriginal.mRandomizerInitState),
-	mRandomizerCurrentSeed(inOriginal.mRandomizerCurrentSeed),
 	mRandomizerCurrentState(inOriginal.mRandomizerCurrentState),
 	mContext(inOriginal.mContext),
 	mSubThreads(inOriginal.mSubThreads),
 	mParallel(inOriginal.mParallel),
 	mSequential(inOriginal.mSequential),
-	mProfiles(inOriginal.mProfiles)
+	mProfiles(inOriginal.mProfiles),
+	mResampleVariables(inOriginal.mResampleVariables)
 {}
 
 /*!
@@ -160,9 +161,28 @@ Individual::Bag::Handle Generator::generate(const std::string& inProfile, unsign
 		}
 	}
 
-	// backup randomizer seeds
-	Core::ULongArray lBackupSeed;
-	Core::StringArray lBackupState;
+	// draw from streams of individuals instead of streams of threads if asked
+	bool lCounterBased = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("randomizer.counter")).getValue();
+	unsigned long lBackupKey = mSystem->getRandomizer(0).getCounterKey();
+	bool lBackupCounterBased = mSystem->getRandomizer(0).isCounterBased();
+
+	// compute variables to re-sample on rejection when generating by blocks
+	// (blocks interleave the draws of individuals, so they are not used with counter-based draws)
+	unsigned int lBlockSize = Core::castObjectT<const Core::UInt&>(mSystem->getParameters().getParameter("generator.block")).getValue();
+	if (lCounterBased) {
+		lBlockSize = 0;
+	}
+	Core::BoolArray::Handle lResampleVariables = NULL;
+	if (lBlockSize > 0) {
+		std::map<std::string, Core::BoolArray::Handle>::const_iterator lIterResample = mResampleVariables.find(inProfile);
+		if (lIterResample == mResampleVariables.end()) {
+			lIterResample = mResampleVariables.insert(std::make_pair(inProfile, computeResampleVariables(*lProfile))).first;
+		}
+		lResampleVariables = lIterResample->second;
+	}
+
+	// backup randomizer states
+	std::vector<Core::Randomizer::State> lBackupState(mContext.size());
 
 	// for computing threads sub-size to generate
 	unsigned int lQuotient = inSize / mContext.size();
@@ -171,7 +191,8 @@ Individual::Bag::Handle Generator::generate(const std::string& inProfile, unsign
 
 	// create subthreads
 	for (unsigned int i = 0; i < mContext.size(); i++) {
-		mContext[i]->setGenProfile(Core::castHandleT<GenProfile>(lProfile->deepCopy(*mSystem)));
+		// profile is shared read-only by all contexts
+		mContext[i]->setGenProfile(lProfile);
 		
 		// create subthread
 		mSubThreads.push_back(new GenerationThread(mParallel, mSequential, mContext[i]));
@@ -184,12 +205,13 @@ Individual::Bag::Handle Generator::generate(const std::string& inProfile, unsign
 		}
 
 		mSubThreads.back()->setGenerationInfo(lSubSize, inPrefix, inStartingIndex, lEraseVariable);
+		mSubThreads.back()->setBatchInfo(lBlockSize, lResampleVariables);
 		inStartingIndex += lSubSize;
 
 		// backup and reset randomizer info
-		lBackupSeed.push_back(mSystem->getRandomizer(i).getSeed());
-		lBackupState.push_back(mSystem->getRandomizer(i).getState());
-		mSystem->getRandomizer(i).reset(mRandomizerCurrentSeed[i], mRandomizerCurrentState[i]);
+		mSystem->getRandomizer(i).saveState(lBackupState[i]);
+		mSystem->getRandomizer(i).loadState(mRandomizerCurrentState[i]);
+		mSystem->getRandomizer(i).setCounterBased(lCounterBased, mRandomizerCurrentState[0].mSeed);
 	}
 
 	// build individuals
@@ -211,9 +233,9 @@ Individual::Bag::Handle Generator::generate(const std::string& inProfile, unsign
 		lIndividuals->insert(lIndividuals->end(), mSubThreads[i]->getIndividuals().begin(), mSubThreads[i]->getIndividuals().end());
 
 		// reset old randomizer info
-		mRandomizerCurrentSeed[i] = mSystem->getRandomizer(i).getSeed();
-		mRandomizerCurrentState[i] = mSystem->getRandomizer(i).getState();
-		mSystem->getRandomizer(i).reset(lBackupSeed[i], lBackupState[i]);
+		mSystem->getRandomizer(i).saveState(mRandomizerCurrentState[i]);
+		mSystem->getRandomizer(i).loadState(lBackupState[i]);
+		mSystem->getRandomizer(i).setCounterBased(lBackupCounterBased, lBackupKey);
 	}
 	
 	// terminate and destroy threads
@@ -229,6 +251,11 @@ Individual::Bag::Handle Generator::generate(const std::string& inProfile, unsign
  */
 void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 	schnaps_StackTraceBeginM();
+	if (inThread->getBlockSize() > 0) {
+		buildIndividualsBatch(inThread);
+		return;
+	}
+
 	GenerationContext::Handle lContext = inThread->getContextHandle();
 	std::stringstream lID;
 	unsigned int lIndividualIndex = inThread->getStartingIndex();
@@ -243,6 +270,7 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 
 		inThread->getIndividuals().push_back(new Individual(lID.str()));
 		lContext->setIndividual(inThread->getIndividuals().back());
+		lContext->getRandomizer().setStream(lIndividualIndex - 1, lContext->getClock().getValue(), SCHNAPS_RANDOMIZER_GENERATION_PHASE);
 
 
 
@@ -252,6 +280,7 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 			
 			for (unsigned int j = 0; j < lContext->getGenProfile().getDemography().getVariablesSize(); j++) {
 				// set local variables
+				lContext->pushLocalFrame();
 				for (unsigned int k = 0; k < lContext->getGenProfile().getDemography().getVariable(j).mLocalVariables.size(); k++) {
 					lContext->insertLocalVariable(
 						lContext->getGenProfile().getDemography().getVariable(j).mLocalVariables[k].first,
@@ -264,7 +293,7 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 					lContext->getGenProfile().getDemography().getVariable(j).mInitTree->interpret(*lContext));
 				
 				// clear local variables
-				lContext->clearLocalVariables();
+				lContext->popLocalFrame();
 			}
 			// retry until a valid individual is created
 		} while (Core::castHandleT<Core::Bool>(lContext->getGenProfile().getAcceptFunction().interpret(*lContext))->getValue() == false);
@@ -272,6 +301,7 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 		// add simulation variables
 		for (unsigned int j = 0; j < lContext->getGenProfile().getSimulationVariables().getVariablesSize(); j++) {
 			// set local variables
+			lContext->pushLocalFrame();
 			for (unsigned int k = 0; k < lContext->getGenProfile().getSimulationVariables().getVariable(j).mLocalVariables.size(); k++) {
 				lContext->insertLocalVariable(
 					lContext->getGenProfile().getSimulationVariables().getVariable(j).mLocalVariables[k].first,
@@ -284,7 +314,7 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 				lContext->getGenProfile().getSimulationVariables().getVariable(j).mInitTree->interpret(*lContext));
 			
 			// clear local variables
-			lContext->clearLocalVariables();
+			lContext->popLocalFrame();
 		}
 
 		// erase non-wanted demographic variables
@@ -296,34 +326,155 @@ void Generator::buildIndividuals(GenerationThread::Handle inThread) {
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::buildIndividuals(SCHNAPS::Simulation::GenerationThread::Handle)");
 }
 
+/*!
+ * \brief Build individuals by blocks using specific thread.
+ *
+ * Variables are initialized one at a time for the whole block (column-wise). An init tree that is
+ * invariant is interpreted once per block and its value is copied to each individual. When the
+ * accept function rejects an individual, only the demography variables on which the accept
+ * function depends (directly or not), and the variables derived from them, are re-sampled.
+ *
+ * \param inThread A handle to the executing thread.
+ */
+void Generator::buildIndividualsBatch(GenerationThread::Handle inThread) {
+	schnaps_StackTraceBeginM();
+	GenerationContext::Handle lContext = inThread->getContextHandle();
+	const GenProfile& lProfile = lContext->getGenProfile();
+	const Demography& lDemography = lProfile.getDemography();
+	const SimulationVariables& lSimulationVariables = lProfile.getSimulationVariables();
+	const Core::BoolArray& lResampleVariables = inThread->getResampleVariables();
+	std::stringstream lID;
+	unsigned int lIndividualIndex = inThread->getStartingIndex();
+	unsigned int lBlockStart, lBlockEnd;
+	Core::AnyType::Handle lValue;
+
+	inThread->getIndividuals().clear();
+	inThread->getIndividuals().reserve(inThread->getSize());
+
+	for (lBlockStart = 0; lBlockStart < inThread->getSize(); lBlockStart = lBlockEnd) {
+		lBlockEnd = std::min(lBlockStart + inThread->getBlockSize(), inThread->getSize());
+
+		// create individuals of block
+		for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+			lID.str("");
+			lID << inThread->getPrefix() << "/" << lIndividualIndex++;
+			inThread->getIndividuals().push_back(new Individual(lID.str()));
+		}
+
+		// add demography variables, one column at a time
+		for (unsigned int j = 0; j < lDemography.getVariablesSize(); j++) {
+			lContext->setIndividual(inThread->getIndividuals()[lBlockStart]);
+			if (lDemography.getVariable(j).mInitTree->isInvariant(*lContext)) {
+				lValue = interpretVariable(*lContext, *lDemography.getVariable(j).mInitTree, lDemography.getVariable(j).mLocalVariables);
+				for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+					inThread->getIndividuals()[i]->getState().insertVariable(lDemography.getVariable(j).mLabel, Core::castHandleT<Core::AnyType>(lValue->clone()));
+				}
+			} else {
+				for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+					lContext->setIndividual(inThread->getIndividuals()[i]);
+					lContext->getIndividual().getState().insertVariable(
+						lDemography.getVariable(j).mLabel,
+						interpretVariable(*lContext, *lDemography.getVariable(j).mInitTree, lDemography.getVariable(j).mLocalVariables));
+				}
+			}
+		}
+
+		// re-sample dependent variables until each individual is accepted
+		for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+			lContext->setIndividual(inThread->getIndividuals()[i]);
+			while (Core::castHandleT<Core::Bool>(lProfile.getAcceptFunction().interpret(*lContext))->getValue() == false) {
+				for (unsigned int j = 0; j < lDemography.getVariablesSize(); j++) {
+					if (lResampleVariables[j]) {
+						lContext->getIndividual().getState().removeVariable(lDemography.getVariable(j).mLabel);
+					}
+				}
+				for (unsigned int j = 0; j < lDemography.getVariablesSize(); j++) {
+					if (lResampleVariables[j]) {
+						lContext->getIndividual().getState().insertVariable(
+							lDemography.getVariable(j).mLabel,
+							interpretVariable(*lContext, *lDemography.getVariable(j).mInitTree, lDemography.getVariable(j).mLocalVariables));
+					}
+				}
+			}
+		}
+
+		// add simulation variables, one column at a time
+		for (unsigned int j = 0; j < lSimulationVariables.getVariablesSize(); j++) {
+			lContext->setIndividual(inThread->getIndividuals()[lBlockStart]);
+			if (lSimulationVariables.getVariable(j).mInitTree->isInvariant(*lContext)) {
+				lValue = interpretVariable(*lContext, *lSimulationVariables.getVariable(j).mInitTree, lSimulationVariables.getVariable(j).mLocalVariables);
+				for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+					inThread->getIndividuals()[i]->getState().insertVariable(lSimulationVariables.getVariable(j).mLabel, Core::castHandleT<Core::AnyType>(lValue->clone()));
+				}
+			} else {
+				for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+					lContext->setIndividual(inThread->getIndividuals()[i]);
+					lContext->getIndividual().getState().insertVariable(
+						lSimulationVariables.getVariable(j).mLabel,
+						interpretVariable(*lContext, *lSimulationVariables.getVariable(j).mInitTree, lSimulationVariables.getVariable(j).mLocalVariables));
+				}
+			}
+		}
+
+		// erase non-wanted demographic variables
+		for (unsigned int i = lBlockStart; i < lBlockEnd; i++) {
+			for (unsigned int j = 0; j < inThread->getEraseVariables().size(); j++) {
+				inThread->getIndividuals()[i]->getState().removeVariable(inThread->getEraseVariables()[j]);
+			}
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::buildIndividualsBatch(SCHNAPS::Simulation::GenerationThread::Handle)");
+}
+
 /*!
  * \brief Generate contacts for all individuals
  * \param inPop A handle to the individuals.
  */
 void Generator::generateContacts(Individual::Bag::Handle inPop){
 	schnaps_StackTraceBeginM();
- 	std::vector<Core::Vector::Handle> lList(inPop->size());
+	Core::ContactGraph::Handle lGraph = new Core::ContactGraph();
 	
 	//backup simulation randomizer, load generation randomizer
-	unsigned long lBackupSeed=mSystem->getRandomizer(0).getSeed();
-	std::string lBackupState=mSystem->getRandomizer(0).getState();
-	mSystem->getRandomizer(0).reset(mRandomizerCurrentSeed[0], mRandomizerCurrentState[0]);
+	Core::Randomizer::State lBackupState;
+	mSystem->getRandomizer(0).saveState(lBackupState);
+	mSystem->getRandomizer(0).loadState(mRandomizerCurrentState[0]);
+	unsigned long lBackupKey = mSystem->getRandomizer(0).getCounterKey();
+	bool lBackupCounterBased = mSystem->getRandomizer(0).isCounterBased();
+	if (Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("randomizer.counter")).getValue()) {
+		mSystem->getRandomizer(0).setCounterBased(true, mRandomizerCurrentState[0].mSeed);
+		mSystem->getRandomizer(0).setStream(SCHNAPS_RANDOMIZER_GLOBAL_STREAM, mClock->getValue(), SCHNAPS_RANDOMIZER_CONTACTS_PHASE);
+	}
 	
 	std::string lContactsGenAlgo = Core::castObjectT<const Core::String&>(mSystem->getParameters().getParameter("contacts.algo")).getValue();
 	Core::ContactsGen::Handle lContactsGen = Core::castHandleT<Core::ContactsGen>(mSystem->getPlugins().getPlugin("Contacts")->getAllocator(lContactsGenAlgo)->allocate());
-	lContactsGen->generate(inPop,mSystem,lList);
+	lContactsGen->generate(inPop,mSystem,*lGraph);
 	
 	//backup generation randomizer, load simulation randomizer
-	mRandomizerCurrentSeed[0] = mSystem->getRandomizer(0).getSeed();
-	mRandomizerCurrentState[0] = mSystem->getRandomizer(0).getState();
-	mSystem->getRandomizer(0).reset(lBackupSeed, lBackupState);
+	mSystem->getRandomizer(0).saveState(mRandomizerCurrentState[0]);
+	mSystem->getRandomizer(0).loadState(lBackupState);
+	mSystem->getRandomizer(0).setCounterBased(lBackupCounterBased, lBackupKey);
+	
+	// renumber individuals so that neighbours are close in memory (and owned by the same thread with contiguous thread indexes)
+	std::string lReorder = Core::castObjectT<const Core::String&>(mSystem->getParameters().getParameter("contacts.reorder")).getValue();
+	if (lReorder == "rcm") {
+		std::vector<unsigned int> lOrder;
+		lGraph->computeReverseCuthillMcKee(lOrder);
+		lGraph->permute(lOrder);
+		Individual::Bag lIndividuals(*inPop);
+		for (unsigned int i = 0; i < lOrder.size(); i++) {
+			(*inPop)[i] = lIndividuals[lOrder[i]];
+		}
+	} else if (lReorder != "none") {
+		throw schnaps_RunTimeExceptionM("Unknown contacts reordering \"" + lReorder + "\"; expected \"none\" or \"rcm\".");
+	}
 	
 	std::string lContactListVariable = Core::castObjectT<const Core::String&>(mSystem->getParameters().getParameter("contacts.variable")).getValue();
-	for (unsigned int i=0; i<inPop->size() ; i++) { //loop over all individuals to finally add their contact lists to the simulation variables
-		(*inPop)[i]->getState().insertVariable(lContactListVariable,lList[i]);
+	for (unsigned int i=0; i<inPop->size() ; i++) { //loop over all individuals to finally add a view on their contacts to the simulation variables
+		Core::ContactList::Handle lList = new Core::ContactList(lGraph, i);
+		(*inPop)[i]->getState().insertVariable(lContactListVariable,lList);
 #ifdef SCHNAPS_DEBUG_CONTACTS
 
-		std::cout << "individual " << i << " list of " << lList[i]->size() << "/" << lListNbContacts[i] << " contacts " << lList[i]->writeStr() << std::endl;
+		std::cout << "individual " << i << " list of " << lList->size() << " contacts " << lList->writeStr() << std::endl;
 #endif
 	}
 
@@ -368,29 +519,146 @@ void Generator::refresh() {
 	}
 	
 	// update generator randomizers information
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	resetRandomizer();
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::refresh()");
 }
 
 void Generator::clearRandomizer() {
 	schnaps_StackTraceBeginM();
-	for (unsigned int i = 0; i < mRandomizerCurrentSeed.size(); i++) {
-		mRandomizerCurrentSeed[i] = 0;
-		mRandomizerCurrentState[i] = "";
+	for (unsigned int i = 0; i < mRandomizerCurrentState.size(); i++) {
+		Core::Randomizer::parseState(0, "", mRandomizerCurrentState[i]);
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::clearRandomizer()");
 }
 
 void Generator::resetRandomizer() {
 	schnaps_StackTraceBeginM();
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	mRandomizerCurrentState.resize(mRandomizerInitSeed.size());
+	for (unsigned int i = 0; i < mRandomizerInitSeed.size(); i++) {
+		Core::Randomizer::parseState(mRandomizerInitSeed[i], mRandomizerInitState[i], mRandomizerCurrentState[i]);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::resetRandomizer()");
 }
 
+/*!
+ * \brief Seed randomizers (one per thread) from a single seed.
+ * \param inSeed The seed (0 for a random seed per randomizer).
+ *
+ * Seeds are derived as in Simulation::Simulator::seedRandomizer; results depend on threads.generator
+ * unless randomizer.counter is set.
+ */
+void Generator::seedRandomizer(unsigned long inSeed) {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mRandomizerCurrentState.size(); i++) {
+		Core::Randomizer::parseState(inSeed == 0 ? 0 : inSeed * 0x9E3779B9UL + i, "", mRandomizerCurrentState[i]);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::seedRandomizer(unsigned long)");
+}
+
 // private functions
 
+/*!
+ * \brief  Compute the demography variables to re-sample when an individual is rejected.
+ *
+ * The variables referred to by the accept function are re-sampled, as well as all variables they
+ * depend on and all variables that depend on any re-sampled variable. Other variables are
+ * independent of the accept function outcome and are kept. When the accept function refers to
+ * no variable directly (e.g. through a process call), all variables are re-sampled, otherwise a
+ * rejected individual would be tested again unchanged. References are compared exactly, primitive
+ * by primitive.
+ *
+ * \param  inProfile A const reference to the generation profile.
+ * \return A handle to flags that indicate which demography variables to re-sample.
+ */
+Core::BoolArray::Handle Generator::computeResampleVariables(const GenProfile& inProfile) const {
+	schnaps_StackTraceBeginM();
+	const Demography& lDemography = inProfile.getDemography();
+	Core::BoolArray::Handle lResample = new Core::BoolArray(lDemography.getVariablesSize(), false);
+
+	// list references of each tree once
+	const Core::PrimitiveTree& lAcceptFunction = inProfile.getAcceptFunction();
+	std::vector<std::string> lAcceptReferences;
+	lAcceptFunction.listReferences(lAcceptReferences);
+	std::vector<std::vector<std::string> > lInitReferences(lDemography.getVariablesSize());
+	std::vector<std::string> lReferences(lDemography.getVariablesSize());
+	for (unsigned int i = 0; i < lDemography.getVariablesSize(); i++) {
+		lDemography.getVariable(i).mInitTree->listReferences(lInitReferences[i]);
+		lReferences[i] = "@" + lDemography.getVariable(i).mLabel;
+	}
+
+	// variables referred to by the accept function
+	bool lAnyReferred = false;
+	for (unsigned int i = 0; i < lDemography.getVariablesSize(); i++) {
+		if (std::find(lAcceptReferences.begin(), lAcceptReferences.end(), lReferences[i]) != lAcceptReferences.end()) {
+			(*lResample)[i] = true;
+			lAnyReferred = true;
+		}
+	}
+
+	// process calls hide their references
+	bool lCallsProcess = false;
+	for (unsigned int i = 0; i < lAcceptFunction.size() && lCallsProcess == false; i++) {
+		lCallsProcess = (lAcceptFunction[i].mPrimitive->getName() == "Control_ProcessCall");
+	}
+
+	// dependencies of accept function are unknown, re-sample everything
+	if (lAnyReferred == false || lCallsProcess) {
+		lResample->assign(lDemography.getVariablesSize(), true);
+		return lResample;
+	}
+
+	// variables on which re-sampled variables depend (only previous variables may be referred to)
+	for (unsigned int i = lDemography.getVariablesSize(); i > 0; i--) {
+		if ((*lResample)[i-1]) {
+			for (unsigned int j = 0; j < i-1; j++) {
+				if (std::find(lInitReferences[i-1].begin(), lInitReferences[i-1].end(), lReferences[j]) != lInitReferences[i-1].end()) {
+					(*lResample)[j] = true;
+				}
+			}
+		}
+	}
+
+	// variables that depend on re-sampled variables
+	for (unsigned int i = 0; i < lDemography.getVariablesSize(); i++) {
+		for (unsigned int j = 0; (j < i) && ((*lResample)[i] == false); j++) {
+			if ((*lResample)[j] && std::find(lInitReferences[i].begin(), lInitReferences[i].end(), lReferences[j]) != lInitReferences[i].end()) {
+				(*lResample)[i] = true;
+			}
+		}
+	}
+	return lResample;
+	schnaps_StackTraceEndM("SCHNAPS::Core::BoolArray::Handle SCHNAPS::Simulation::Generator::computeResampleVariables(const SCHNAPS::Simulation::GenProfile&) const");
+}
+
+/*!
+ * \brief  Interpret a variable init tree with its local variables.
+ * \param  ioContext A reference to the generation context.
+ * \param  inInitTree A const reference to the variable init tree.
+ * \param  inLocalVariables A const reference to the initial values of local variables.
+ * \return A handle to the variable init value.
+ */
+Core::AnyType::Handle Generator::interpretVariable(GenerationContext& ioContext, const Core::PrimitiveTree& inInitTree, const std::vector<std::pair<std::string, Core::AnyType::Handle> >& inLocalVariables) {
+	schnaps_StackTraceBeginM();
+	// set local variables
+	if (inLocalVariables.empty() == false) {
+		ioContext.pushLocalFrame();
+	}
+	for (unsigned int k = 0; k < inLocalVariables.size(); k++) {
+		ioContext.insertLocalVariable(inLocalVariables[k].first, Core::castHandleT<Core::AnyType>(inLocalVariables[k].second->clone()));
+	}
+
+	// compute variable init value
+	Core::AnyType::Handle lValue = inInitTree.interpret(ioContext);
+
+	// clear local variables
+	if (inLocalVariables.empty() == false) {
+		ioContext.popLocalFrame();
+	}
+	return lValue;
+	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Simulation::Generator::interpretVariable(SCHNAPS::Simulation::GenerationContext&, const SCHNAPS::Core::PrimitiveTree&, const std::vector<std::pair<std::string, SCHNAPS::Core::AnyType::Handle> >&)");
+}
+
+
 void Generator::readRandomizerInfo(PACC::XML::ConstIterator inIter) {
 	schnaps_StackTraceBeginM();
 	schnaps_NonNullPointerAssertM(mSystem);
@@ -434,8 +702,7 @@ printf("Reading randomizer info\n");
         }
 	}
 
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	resetRandomizer();
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Generator::readRandomizerInfo(PACC::XML::ConstIterator)");
 }
 
@@ -456,6 +723,7 @@ void Generator::readProfiles(PACC::XML::ConstIterator inIter) {
 printf("Reading profiles\n");
 #endif
 
+	mResampleVariables.clear();
 	for (PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; lChild++) {
 		if (lChild->getType() == PACC::XML::eData) {
 			mProfiles.insert(std::pair<std::string, GenProfile::Handle>(lChild->getAttribute("label"), new GenProfile()));
@@ -35,10 +35,11 @@
 #include <hash_map>
 #elif defined(SCHNAPS_HAVE_GNUCXX_HASHMAP)
 #include <tr1/unordered_map>
-#else
-#include <map>
 #endif
 
+#include <map>
+#include <string>
+
 #define NBCONTACTS_VARIABLE "ref.nbContacts_"
 #define CONTACTS_FLAG "ref.Contacts"
 
@@ -95,6 +96,8 @@ public:
 	
 	//! Build individuals using specific thread.
 	static void buildIndividuals(GenerationThread::Handle inThread);
+	//! Build individuals by blocks using specific thread.
+	static void buildIndividualsBatch(GenerationThread::Handle inThread);
 	
 	//! Optionally generate contact lists for all individuals.
 	void generateContacts(Individual::Bag::Handle inPop);
@@ -106,6 +109,8 @@ public:
 	void clearRandomizer();
 	//! Reset randomizer to intial seed and state.
 	void resetRandomizer();
+	//! Seed randomizers (one per thread) from a single seed.
+	void seedRandomizer(unsigned long inSeed);
 
 	/*!
 	 * \brief  Return a const reference to the system.
@@ -138,6 +143,11 @@ public:
 	}
 
 private:
+	//! Compute the demography variables to re-sample when an individual is rejected.
+	Core::BoolArray::Handle computeResampleVariables(const GenProfile& inProfile) const;
+	//! Interpret a variable init tree with its local variables.
+	static Core::AnyType::Handle interpretVariable(GenerationContext& ioContext, const Core::PrimitiveTree& inInitTree, const std::vector<std::pair<std::string, Core::AnyType::Handle> >& inLocalVariables);
+
 	// sub reads
 	void readRandomizerInfo(PACC::XML::ConstIterator inIter);
 	void readProfiles(PACC::XML::ConstIterator inIter);
@@ -158,8 +168,7 @@ private:
 	// randomizers info
 	Core::ULongArray mRandomizerInitSeed;		//!< Init registered seed of random number generators (one per thread).
 	Core::StringArray mRandomizerInitState;		//!< Init state of random number generators (one per thread).
-	Core::ULongArray mRandomizerCurrentSeed;	//!< Current registered seed of random number generators (one per thread).
-	Core::StringArray mRandomizerCurrentState;	//!< Current state of random number generators (one per thread).
+	std::vector<Core::Randomizer::State> mRandomizerCurrentState;	//!< Current seed and state of random number generators (one per thread).
 
 	GenerationContext::Bag mContext;
 
@@ -170,6 +179,7 @@ private:
 
 	// profiles
 	ProfileMap mProfiles;						//!< Population profiles (maps profile name to generator profile).
+	std::map<std::string, Core::BoolArray::Handle> mResampleVariables;	//!< Demography variables to re-sample on rejection, per profile name.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
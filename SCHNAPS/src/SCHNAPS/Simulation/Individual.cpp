@@ -30,7 +30,10 @@ using namespace Simulation;
  */
 Individual::Individual(std::string inID) :
 		mID(inID),
-		mActive(true)
+		mActive(true),
+		mReleased(false),
+		mSpillOffset(-1),
+		mSpillSize(0)
 {}
 
 /*!
@@ -40,7 +43,11 @@ Individual::Individual(std::string inID) :
 Individual::Individual(const Individual& inOriginal) :
 		mID(inOriginal.mID.c_str()),
 		mState(inOriginal.mState),
-		mActive(true)
+		mActive(true),
+		mReleased(inOriginal.mReleased),
+		mOutput(inOriginal.mOutput),
+		mSpillOffset(inOriginal.mSpillOffset),
+		mSpillSize(inOriginal.mSpillSize)
 {}
 
 /*!
@@ -86,7 +93,49 @@ void Individual::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) co
  * \param inVariables A const reference to the labels of variables to print.
  */
 void Individual::print(std::ostream& ioStream, const std::vector<std::string> inVariables) const {
+	schnaps_StackTraceBeginM();
+	if (mReleased) {
+		if (mSpillOffset >= 0) {
+			throw schnaps_RunTimeExceptionM("Cannot print individual " + mID + ": its output has been spilled and must be read back from the spill file!");
+		}
+		ioStream << mOutput;
+		return;
+	}
 	ioStream << mID;
 	mState.print(ioStream, inVariables);
 	ioStream << std::endl;
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Individual::print(std::ostream&, const std::vector<std::string>) const");
+}
+
+/*!
+ * \brief Serialize the output of individual and release its state.
+ *
+ * The individual is kept as a tombstone (ID and status only) so that the population indexes and
+ * the output order are preserved. The serialized output is kept in memory, or written to the
+ * spill file if provided, in which case only its offset and size are kept.
+ *
+ * \param inVariables A const reference to the labels of variables to print.
+ * \param ioSpill A pointer to the spill file (NULL to keep the output in memory).
+ * \throw SCHNAPS::Core::IOException if the spill file cannot be extended.
+ */
+void Individual::release(const std::vector<std::string>& inVariables, MappedFile* ioSpill) {
+	schnaps_StackTraceBeginM();
+	if (mReleased) {
+		return;
+	}
+
+	std::ostringstream lOSS;
+	print(lOSS, inVariables);
+
+	if (ioSpill == NULL) {
+		mOutput = lOSS.str();
+	} else {
+		mSpillSize = lOSS.str().size();
+		mSpillOffset = static_cast<long>(ioSpill->append(lOSS.str().c_str(), mSpillSize));
+	}
+
+	// free state memory
+	mState.clear();
+	mReleased = true;
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Individual::release(const std::vector<std::string>&, SCHNAPS::Simulation::MappedFile*)");
 }
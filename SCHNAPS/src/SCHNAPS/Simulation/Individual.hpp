@@ -26,6 +26,7 @@
 #include "SCHNAPS/Core/PointerT.hpp"
 #include "SCHNAPS/Core/ContainerT.hpp"
 #include "SCHNAPS/Simulation/State.hpp"
+#include "SCHNAPS/Simulation/MappedFile.hpp"
 
 namespace SCHNAPS {
 namespace Simulation {
@@ -65,6 +66,8 @@ public:
 
 	//! Print individual to file stream.
 	void print(std::ostream& ioStream, const std::vector<std::string> inVariables) const;
+	//! Serialize the output of individual and release its state.
+	void release(const std::vector<std::string>& inVariables, MappedFile* ioSpill = NULL);
 
 	/*!
 	 * \brief  Return a const reference to the ID.
@@ -121,6 +124,30 @@ public:
 		return mActive;
 	}
 
+	/*!
+	 * \brief  Return true if the state has been released (the individual is a tombstone).
+	 * \return True if the state has been released, false if not.
+	 */
+	bool isReleased() const {
+		return mReleased;
+	}
+
+	/*!
+	 * \brief  Return the offset of the serialized output in the spill file.
+	 * \return The offset of the serialized output in the spill file (-1 if kept in memory).
+	 */
+	long getSpillOffset() const {
+		return mSpillOffset;
+	}
+
+	/*!
+	 * \brief  Return the size of the serialized output in the spill file.
+	 * \return The size of the serialized output in the spill file.
+	 */
+	unsigned long getSpillSize() const {
+		return mSpillSize;
+	}
+
 	/*!
 	 * \brief Set the ID to a specific value.
 	 * \param inID A reference to the new ID.
@@ -148,6 +175,11 @@ protected:
 	std::string mID;	//!< Individual ID tag;
 	State mState;		//!< The state that describes the individual.
 	bool mActive;		//!< Indicates if the individual is active or idle, thus considered by the simulation or not.
+
+	bool mReleased;				//!< Indicates if the state has been released after serializing the output.
+	std::string mOutput;		//!< Serialized output of released individual (if kept in memory).
+	long mSpillOffset;			//!< Offset of serialized output in spill file (-1 if kept in memory).
+	unsigned long mSpillSize;	//!< Size of serialized output in spill file.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
@@ -0,0 +1,203 @@
+/*
+ * MappedFile.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+#include "SCHNAPS/Simulation.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef SCHNAPS_IS_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace SCHNAPS;
+using namespace Simulation;
+
+/*!
+ * \brief Default constructor.
+ */
+MappedFile::MappedFile() :
+	mOpen(false),
+	mSize(0)
+#ifdef SCHNAPS_IS_UNIX
+	, mData(NULL)
+	, mCapacity(0)
+	, mDescriptor(-1)
+#else
+	, mStream(NULL)
+#endif
+{}
+
+/*!
+ * \brief Destructor, unmapping and removing the file if still open.
+ */
+MappedFile::~MappedFile() {
+	if (mOpen) {
+		close();
+	}
+}
+
+/*!
+ * \brief Create a file and map it in memory.
+ * \param inFile A const reference to the name of file.
+ * \throw SCHNAPS::Core::IOException if the file cannot be created or mapped.
+ */
+void MappedFile::open(const std::string& inFile) {
+	schnaps_StackTraceBeginM();
+	if (mOpen) {
+		close();
+	}
+	mFile = inFile;
+#ifdef SCHNAPS_IS_UNIX
+	mDescriptor = ::open(mFile.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if (mDescriptor < 0) {
+		throw schnaps_IOExceptionMessageM("Can't write to " + mFile);
+	}
+	mOpen = true;
+	reserve(SCHNAPS_MAPPEDFILE_CAPACITY);
+#else
+	mStream = std::fopen(mFile.c_str(), "w+b");
+	if (mStream == NULL) {
+		throw schnaps_IOExceptionMessageM("Can't write to " + mFile);
+	}
+	mOpen = true;
+#endif
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::MappedFile::open(const std::string&)");
+}
+
+/*!
+ * \brief Unmap and remove the file.
+ */
+void MappedFile::close() {
+	schnaps_StackTraceBeginM();
+#ifdef SCHNAPS_IS_UNIX
+	if (mData != NULL) {
+		munmap(mData, mCapacity);
+	}
+	if (mDescriptor >= 0) {
+		::close(mDescriptor);
+		mDescriptor = -1;
+	}
+	mData = NULL;
+	mCapacity = 0;
+#else
+	if (mStream != NULL) {
+		std::fclose(mStream);
+		mStream = NULL;
+	}
+#endif
+	std::remove(mFile.c_str());
+	mOpen = false;
+	mSize = 0;
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::MappedFile::close()");
+}
+
+/*!
+ * \brief  Append data at the end of file.
+ * \param  inData A const pointer to the data.
+ * \param  inSize The size of data (in bytes).
+ * \return The offset of data in file.
+ * \throw  SCHNAPS::Core::AssertException if the file is not open.
+ * \throw  SCHNAPS::Core::IOException if the file cannot be extended or written.
+ */
+unsigned long MappedFile::append(const char* inData, unsigned long inSize) {
+	schnaps_StackTraceBeginM();
+	schnaps_AssertM(mOpen);
+	unsigned long lOffset = mSize;
+#ifdef SCHNAPS_IS_UNIX
+	reserve(mSize + inSize);
+	std::memcpy(mData + lOffset, inData, inSize);
+#else
+	if (std::fseek(mStream, static_cast<long>(lOffset), SEEK_SET) != 0 || std::fwrite(inData, 1, inSize, mStream) != inSize) {
+		throw schnaps_IOExceptionMessageM("Can't write to " + mFile);
+	}
+#endif
+	mSize += inSize;
+	return lOffset;
+	schnaps_StackTraceEndM("unsigned long SCHNAPS::Simulation::MappedFile::append(const char*, unsigned long)");
+}
+
+/*!
+ * \brief Copy data from file to an output stream.
+ * \param inOffset The offset of data in file.
+ * \param inSize The size of data (in bytes).
+ * \param ioStream A reference to the output stream.
+ * \throw SCHNAPS::Core::AssertException if the data is not within the file.
+ * \throw SCHNAPS::Core::IOException if the file cannot be read.
+ */
+void MappedFile::copy(unsigned long inOffset, unsigned long inSize, std::ostream& ioStream) const {
+	schnaps_StackTraceBeginM();
+	schnaps_AssertM(mOpen);
+	schnaps_AssertM(inOffset + inSize <= mSize);
+#ifdef SCHNAPS_IS_UNIX
+	ioStream.write(mData + inOffset, inSize);
+#else
+	char lBuffer[4096];
+	if (std::fseek(mStream, static_cast<long>(inOffset), SEEK_SET) != 0) {
+		throw schnaps_IOExceptionMessageM("Can't read from " + mFile);
+	}
+	while (inSize > 0) {
+		unsigned long lCount = (inSize < sizeof(lBuffer)) ? inSize : sizeof(lBuffer);
+		if (std::fread(lBuffer, 1, lCount, mStream) != lCount) {
+			throw schnaps_IOExceptionMessageM("Can't read from " + mFile);
+		}
+		ioStream.write(lBuffer, lCount);
+		inSize -= lCount;
+	}
+#endif
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::MappedFile::copy(unsigned long, unsigned long, std::ostream&) const");
+}
+
+#ifdef SCHNAPS_IS_UNIX
+/*!
+ * \brief Grow the mapping to hold at least a specific number of bytes.
+ * \param inCapacity The number of bytes to hold.
+ * \throw SCHNAPS::Core::IOException if the file cannot be extended or mapped.
+ *
+ * The new mapping is made before the previous one is released, so that the file stays
+ * usable with its previous capacity if growing fails.
+ */
+void MappedFile::reserve(unsigned long inCapacity) {
+	schnaps_StackTraceBeginM();
+	if (inCapacity <= mCapacity) {
+		return;
+	}
+	unsigned long lCapacity = (mCapacity == 0) ? SCHNAPS_MAPPEDFILE_CAPACITY : mCapacity;
+	while (lCapacity < inCapacity) {
+		lCapacity *= 2;
+	}
+	if (ftruncate(mDescriptor, lCapacity) != 0) {
+		throw schnaps_IOExceptionMessageM("Can't extend " + mFile);
+	}
+	void* lData = mmap(NULL, lCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, mDescriptor, 0);
+	if (lData == MAP_FAILED) {
+		throw schnaps_IOExceptionMessageM("Can't map " + mFile);
+	}
+	if (mData != NULL) {
+		munmap(mData, mCapacity);
+	}
+	mData = static_cast<char*>(lData);
+	mCapacity = lCapacity;
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::MappedFile::reserve(unsigned long)");
+}
+#endif
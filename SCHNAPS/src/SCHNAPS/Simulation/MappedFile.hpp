@@ -0,0 +1,118 @@
+/*
+ * MappedFile.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Simulation_MappedFile_hpp
+#define SCHNAPS_Simulation_MappedFile_hpp
+
+#include "SCHNAPS/Core/Object.hpp"
+#include "SCHNAPS/Core/AllocatorT.hpp"
+#include "SCHNAPS/Core/PointerT.hpp"
+#include "SCHNAPS/Core/ContainerT.hpp"
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+// initial capacity of a mapped file (in bytes)
+#define SCHNAPS_MAPPEDFILE_CAPACITY 1048576UL
+
+namespace SCHNAPS {
+namespace Simulation {
+
+/*!
+ *  \class MappedFile SCHNAPS/Simulation/MappedFile.hpp "SCHNAPS/Simulation/MappedFile.hpp"
+ *  \brief Append-only temporary file mapped in memory.
+ *
+ *  Data is written and read back through the mapping, so that it is paged in and out by the
+ *  operating system instead of being held in process memory. The mapping doubles in size when
+ *  full. On systems without mmap, data is written to and read back from the file with stdio.
+ *
+ *  It holds the output of released individuals; live individuals keep their State in memory.
+ */
+class MappedFile: public Core::Object {
+public:
+	//! MappedFile allocator type.
+	typedef Core::AllocatorT<MappedFile, Core::Object::Alloc> Alloc;
+	//! MappedFile handle type.
+	typedef Core::PointerT<MappedFile, Core::Object::Handle> Handle;
+	//! MappedFile bag type.
+	typedef Core::ContainerT<MappedFile, Core::Object::Bag> Bag;
+
+	MappedFile();
+	virtual ~MappedFile();
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("MappedFile");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Simulation::MappedFile::getName() const");
+	}
+
+	//! Create a file and map it in memory.
+	void open(const std::string& inFile);
+	//! Unmap and remove the file.
+	void close();
+	//! Append data at the end of file.
+	unsigned long append(const char* inData, unsigned long inSize);
+	//! Copy data from file to an output stream.
+	void copy(unsigned long inOffset, unsigned long inSize, std::ostream& ioStream) const;
+
+	/*!
+	 * \brief  Return true if the file is open.
+	 * \return True if the file is open.
+	 */
+	bool isOpen() const {
+		return mOpen;
+	}
+
+	/*!
+	 * \brief  Return the size of data written.
+	 * \return The size of data written (in bytes).
+	 */
+	unsigned long getSize() const {
+		return mSize;
+	}
+
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+	std::string mFile;			//!< Name of file.
+	bool mOpen;					//!< Wether the file is open.
+	unsigned long mSize;		//!< Size of data written (in bytes).
+#ifdef SCHNAPS_IS_UNIX
+	//! Grow the mapping to hold at least a specific number of bytes.
+	void reserve(unsigned long inCapacity);
+
+	char* mData;				//!< Pointer to mapped data.
+	unsigned long mCapacity;	//!< Size of mapping (in bytes).
+	int mDescriptor;			//!< File descriptor.
+#else
+	std::FILE* mStream;			//!< File stream used in place of mapping.
+#endif
+};
+} // end of Simulation namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Simulation_MappedFile_hpp */
@@ -0,0 +1,138 @@
+/*
+ * ObserverSchedule.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+#include "SCHNAPS/Simulation.hpp"
+
+#include <algorithm>
+#include <functional>
+
+using namespace SCHNAPS;
+using namespace Simulation;
+
+/*!
+ * \brief Remove all observers from the schedule.
+ */
+void ObserverSchedule::clear() {
+	schnaps_StackTraceBeginM();
+	mEntries.clear();
+	mEvents.clear();
+	mRescheduled.clear();
+	mDueForEnvironment.clear();
+	mDueForIndividuals.clear();
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ObserverSchedule::clear()");
+}
+
+/*!
+ * \brief  Add an observer to the schedule.
+ * \param  inLabel A const reference to the label of the observing process.
+ * \param  inStart The first occurence (in observer units).
+ * \param  inEnd The last occurence (in observer units), 0 if none.
+ * \param  inStep The step between each occurence (in observer units).
+ * \param  inUnits Observer units.
+ * \param  inEnvironment True if the observer targets the environment, false if it targets all individuals.
+ * \return The index of the observer in the schedule.
+ */
+unsigned int ObserverSchedule::insert(const std::string& inLabel, unsigned long inStart, unsigned long inEnd, unsigned long inStep, Clock::Units inUnits, bool inEnvironment) {
+	schnaps_StackTraceBeginM();
+	Entry lEntry;
+	lEntry.mLabel = inLabel;
+	lEntry.mStart = inStart;
+	lEntry.mEnd = inEnd;
+	lEntry.mStep = inStep;
+	lEntry.mUnits = inUnits;
+	lEntry.mEnvironment = inEnvironment;
+	mEntries.push_back(lEntry);
+	return mEntries.size() - 1;
+	schnaps_StackTraceEndM("unsigned int SCHNAPS::Simulation::ObserverSchedule::insert(const std::string&, unsigned long, unsigned long, unsigned long, SCHNAPS::Simulation::Clock::Units, bool)");
+}
+
+/*!
+ * \brief Compute the first occurence of each observer.
+ * \param inClock A const reference to the simulation clock.
+ */
+void ObserverSchedule::reset(const Clock& inClock) {
+	schnaps_StackTraceBeginM();
+	mEvents.clear();
+	mRescheduled.clear();
+	mDueForEnvironment.clear();
+	mDueForIndividuals.clear();
+
+	// reserve once so that updates never allocate
+	mEvents.reserve(mEntries.size());
+	mRescheduled.reserve(mEntries.size());
+	mDueForEnvironment.reserve(mEntries.size());
+	mDueForIndividuals.reserve(mEntries.size());
+
+	for (unsigned int i = 0; i < mEntries.size(); i++) {
+		mEvents.push_back(Event(inClock.getTick(mEntries[i].mStart, mEntries[i].mUnits), i));
+	}
+	std::make_heap(mEvents.begin(), mEvents.end(), std::greater<Event>());
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ObserverSchedule::reset(const SCHNAPS::Simulation::Clock&)");
+}
+
+/*!
+ * \brief Collect the observers due at the current clock tick and compute their next occurence.
+ * \param inClock A const reference to the simulation clock.
+ */
+void ObserverSchedule::update(const Clock& inClock) {
+	schnaps_StackTraceBeginM();
+	unsigned long lTick = inClock.getValue();
+	unsigned long lValue;
+
+	mDueForEnvironment.clear();
+	mDueForIndividuals.clear();
+	mRescheduled.clear();
+
+	while (!mEvents.empty() && mEvents.front().first <= lTick) {
+		Event lEvent = mEvents.front();
+		std::pop_heap(mEvents.begin(), mEvents.end(), std::greater<Event>());
+		mEvents.pop_back();
+
+		// occurences before current time step were never reached
+		if (lEvent.first < lTick) {
+			continue;
+		}
+
+		const Entry& lEntry = mEntries[lEvent.second];
+		if (lEntry.mEnvironment) {
+			mDueForEnvironment.push_back(lEvent.second);
+		} else {
+			mDueForIndividuals.push_back(lEvent.second);
+		}
+
+		// compute next occurence of the observer
+		lValue = inClock.getValue(lEntry.mUnits) + lEntry.mStep;
+		if (lEntry.mEnd == 0 || lValue <= lEntry.mEnd) {
+			mRescheduled.push_back(Event(inClock.getTick(lValue, lEntry.mUnits), lEvent.second));
+		}
+	}
+
+	// update next occurence of the observers
+	for (unsigned int i = 0; i < mRescheduled.size(); i++) {
+		mEvents.push_back(mRescheduled[i]);
+		std::push_heap(mEvents.begin(), mEvents.end(), std::greater<Event>());
+	}
+
+	// trigger observers in schedule order
+	std::sort(mDueForEnvironment.begin(), mDueForEnvironment.end());
+	std::sort(mDueForIndividuals.begin(), mDueForIndividuals.end());
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ObserverSchedule::update(const SCHNAPS::Simulation::Clock&)");
+}
@@ -0,0 +1,130 @@
+/*
+ * ObserverSchedule.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2011 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Simulation_ObserverSchedule_hpp
+#define SCHNAPS_Simulation_ObserverSchedule_hpp
+
+#include "SCHNAPS/Core/Object.hpp"
+#include "SCHNAPS/Simulation/Clock.hpp"
+
+#include <climits>
+#include <string>
+#include <vector>
+
+namespace SCHNAPS {
+namespace Simulation {
+
+/*!
+ *  \class ObserverSchedule SCHNAPS/Simulation/ObserverSchedule.hpp "SCHNAPS/Simulation/ObserverSchedule.hpp"
+ *  \brief Compiled schedule of clock observers, shared by all simulation contexts.
+ *
+ *  Observers are numbered once per run and their next occurences are kept in a heap of (clock tick, observer index).
+ *  The schedule is advanced once per time step by the simulator; contexts only read the indexes of due observers
+ *  and map them to their own processes, so no string lookup nor allocation happens at each time step.
+ */
+class ObserverSchedule: public Core::Object {
+public:
+	/*!
+	 * \struct Entry SCHNAPS/Simulation/ObserverSchedule.hpp "SCHNAPS/Simulation/ObserverSchedule.hpp"
+	 * \brief  Timing of a clock observer.
+	 */
+	struct Entry {
+		std::string mLabel;		//!< The label of the observing process.
+		unsigned long mStart;	//!< The first occurence (in observer units).
+		unsigned long mEnd;		//!< The last occurence (in observer units), 0 if none.
+		unsigned long mStep;	//!< The step between each occurence (in observer units).
+		Clock::Units mUnits;	//!< Observer units.
+		bool mEnvironment;		//!< True if the observer targets the environment, false if it targets all individuals.
+	};
+
+	typedef std::pair<unsigned long, unsigned int> Event;	//!< Clock tick of next occurence and observer index.
+
+	//! ObserverSchedule allocator type.
+	typedef Core::AllocatorT<ObserverSchedule, Core::Object::Alloc> Alloc;
+	//! ObserverSchedule handle type.
+	typedef Core::PointerT<ObserverSchedule, Core::Object::Handle> Handle;
+	//! ObserverSchedule bag type.
+	typedef Core::ContainerT<ObserverSchedule, Core::Object::Bag> Bag;
+
+	ObserverSchedule() {}
+	virtual ~ObserverSchedule() {}
+
+	/*!
+	 * \brief  Return a const reference to the name of object.
+	 * \return A const reference to the name of object.
+	 */
+	virtual const std::string& getName() const {
+		schnaps_StackTraceBeginM();
+		const static std::string lName("ObserverSchedule");
+		return lName;
+		schnaps_StackTraceEndM("const std::string& SCHNAPS::Simulation::ObserverSchedule::getName() const");
+	}
+
+	void clear();
+	unsigned int insert(const std::string& inLabel, unsigned long inStart, unsigned long inEnd, unsigned long inStep, Clock::Units inUnits, bool inEnvironment);
+	void reset(const Clock& inClock);
+	void update(const Clock& inClock);
+
+	/*!
+	 * \brief  Return a const reference to the scheduled observers.
+	 * \return A const reference to the scheduled observers, in index order.
+	 */
+	const std::vector<Entry>& getEntries() const {
+		return mEntries;
+	}
+
+	/*!
+	 * \brief  Return a const reference to the indexes of observers that target the environment at the current time step.
+	 * \return A const reference to the indexes of observers that target the environment at the current time step.
+	 */
+	const std::vector<unsigned int>& getDueForEnvironment() const {
+		return mDueForEnvironment;
+	}
+
+	/*!
+	 * \brief  Return a const reference to the indexes of observers that target all individuals at the current time step.
+	 * \return A const reference to the indexes of observers that target all individuals at the current time step.
+	 */
+	const std::vector<unsigned int>& getDueForIndividuals() const {
+		return mDueForIndividuals;
+	}
+
+	/*!
+	 * \brief  Return the next clock tick at which an observer must be executed.
+	 * \return The next clock tick after the last update, or ULONG_MAX if there is none.
+	 */
+	unsigned long getNextExecution() const {
+		if (mEvents.empty()) {
+			return ULONG_MAX;
+		}
+		return mEvents.front().first;
+	}
+
+private:
+	std::vector<Entry> mEntries;					//!< Scheduled observers.
+	std::vector<Event> mEvents;						//!< Min-heap of next occurences.
+	std::vector<Event> mRescheduled;				//!< Next occurences of observers due at current time step.
+	std::vector<unsigned int> mDueForEnvironment;	//!< Indexes of observers that target the environment at current time step.
+	std::vector<unsigned int> mDueForIndividuals;	//!< Indexes of observers that target all individuals at current time step.
+};
+} // end of Simulation namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Simulation_ObserverSchedule_hpp */
@@ -0,0 +1,89 @@
+/*
+ * ParsingThread.cpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SCHNAPS/Core.hpp"
+#include "SCHNAPS/Simulation.hpp"
+
+#include <algorithm>
+
+using namespace SCHNAPS;
+using namespace Simulation;
+
+/*!
+ * \brief Construct and start a thread.
+ * \param inFiles A pointer to the files to parse.
+ * \param ioDocuments A pointer to the parsed documents, per file.
+ * \param inThread Index of the thread.
+ * \param inNbThreads Total number of parsing threads.
+ */
+ParsingThread::ParsingThread(const std::vector<std::string>* inFiles, std::vector<PACC::XML::Document*>* ioDocuments, unsigned int inThread, unsigned int inNbThreads) :
+	mFiles(inFiles),
+	mDocuments(ioDocuments),
+	mThread(inThread),
+	mNbThreads(inNbThreads)
+{
+	run();
+}
+
+/*!
+ * \brief Wait for the end of the thread.
+ */
+ParsingThread::~ParsingThread() {
+	wait();
+}
+
+/*!
+ * \brief Parse a list of XML files using multiple threads.
+ * \param inFiles A const reference to the files to parse.
+ * \param outDocuments A reference to the parsed documents, per file (NULL if a file was not parsed).
+ * \param inNbThreads Number of threads.
+ *
+ * Nothing is parsed with a single thread. Documents are allocated with new and must be deleted
+ * by the caller.
+ */
+void ParsingThread::parse(const std::vector<std::string>& inFiles, std::vector<PACC::XML::Document*>& outDocuments, unsigned int inNbThreads) {
+	schnaps_StackTraceBeginM();
+	outDocuments.assign(inFiles.size(), NULL);
+	unsigned int lNbThreads = std::min<unsigned int>(inNbThreads, inFiles.size());
+	if (lNbThreads > 1) {
+		ParsingThread::Bag lThreads;
+		for (unsigned int i = 0; i < lNbThreads; i++) {
+			lThreads.push_back(new ParsingThread(&inFiles, &outDocuments, i, lNbThreads));
+		}
+		// threads are joined when destroyed
+		lThreads.clear();
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::ParsingThread::parse(const std::vector<std::string>&, std::vector<PACC::XML::Document*>&, unsigned int)");
+}
+
+/*!
+ * \brief Parse the files associated to the thread.
+ */
+void ParsingThread::main() {
+	for (unsigned int i = mThread; i < mFiles->size(); i += mNbThreads) {
+		PACC::XML::Document* lDocument = new PACC::XML::Document();
+		try {
+			lDocument->parse((*mFiles)[i]);
+			(*mDocuments)[i] = lDocument;
+		} catch (...) {
+			delete lDocument;
+		}
+	}
+}
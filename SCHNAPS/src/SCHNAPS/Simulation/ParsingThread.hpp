@@ -0,0 +1,70 @@
+/*
+ * ParsingThread.hpp
+ *
+ * SCHNAPS
+ * Copyright (C) 2009-2014 by Audrey Durand
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHNAPS_Simulation_ParsingThread_hpp
+#define SCHNAPS_Simulation_ParsingThread_hpp
+
+#include "PACC/PACC.hpp"
+#include "PACC/XML.hpp"
+
+#include "SCHNAPS/Core/Object.hpp"
+
+#include <string>
+#include <vector>
+
+namespace SCHNAPS {
+namespace Simulation {
+
+/*!
+ *  \class ParsingThread SCHNAPS/Simulation/ParsingThread.hpp "SCHNAPS/Simulation/ParsingThread.hpp"
+ *  \brief Thread parsing its share of a list of XML files. It starts on construction and is joined on destruction.
+ *
+ *  Thread i parses files i, i+n, i+2n, ... of the list, n being the number of threads. A file that
+ *  cannot be parsed is left NULL in the list of documents, so that the caller can parse it again
+ *  and report the error as usual.
+ */
+class ParsingThread: public Core::Object, public PACC::Threading::Thread {
+public:
+	//! ParsingThread allocator type.
+	typedef Core::AllocatorT<ParsingThread, Core::Object::Alloc> Alloc;
+	//! ParsingThread handle type.
+	typedef Core::PointerT<ParsingThread, Core::Object::Handle> Handle;
+	//! ParsingThread bag type.
+	typedef Core::ContainerT<ParsingThread, Core::Object::Bag> Bag;
+
+	ParsingThread(const std::vector<std::string>* inFiles, std::vector<PACC::XML::Document*>* ioDocuments, unsigned int inThread, unsigned int inNbThreads);
+	~ParsingThread();
+
+	//! Parse a list of XML files using multiple threads.
+	static void parse(const std::vector<std::string>& inFiles, std::vector<PACC::XML::Document*>& outDocuments, unsigned int inNbThreads);
+
+protected:
+	virtual void main();
+
+private:
+	const std::vector<std::string>* mFiles;				//!< Files to parse.
+	std::vector<PACC::XML::Document*>* mDocuments;		//!< Parsed documents, per file.
+	unsigned int mThread;								//!< Index of the thread.
+	unsigned int mNbThreads;							//!< Total number of parsing threads.
+};
+} // end of Simulation namespace
+} // end of SCHNAPS namespace
+
+#endif /* SCHNAPS_Simulation_ParsingThread_hpp */
@@ -64,6 +64,7 @@ Process::Handle Process::deepCopy(const Core::System& inSystem) const {
 			this->mLocalVariables[i].first,
 			this->mLocalVariables[i].second));
 	}
+	lCopy->mLocalLabels = this->mLocalLabels;
 	return lCopy;
 	schnaps_StackTraceEndM("SCHNAPS::Simulation::Process::Handle SCHNAPS::Simulation::Process::deepCopy(const SCHNAPS::Core::System&) const ");
 }
@@ -151,6 +152,7 @@ void Process::readLocalVariables(PACC::XML::ConstIterator inIter, Core::System&
 	}
 	
 	mLocalVariables.clear();
+	mLocalLabels.clear();
 	
 	Core::AnyType::Handle lValue;
 	Core::Object::Alloc::Handle lAlloc;
@@ -176,6 +178,7 @@ void Process::readLocalVariables(PACC::XML::ConstIterator inIter, Core::System&
 		lValue->readWithSystem(lChild->getFirstChild(), ioSystem);
 		
 		mLocalVariables.push_back(std::pair<std::string, Core::AnyType::Handle>(lChild->getAttribute("label"), lValue));
+		mLocalLabels.push_back(lChild->getAttribute("label"));
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Process::readLocalVariables(PACC::XML::ConstIterator, SCHNAPS::Core::System&)");
 }
@@ -184,20 +187,35 @@ void Process::readLocalVariables(PACC::XML::ConstIterator inIter, Core::System&
  * \brief  Return a handle to the result of process execution.
  * \param  ioContext A reference to the execution context required for primitive tree function execution.
  * \return A handle to the result of process execution.
+ *
+ * Local variables of process live in a frame pushed on context for the duration of execution, so
+ * that local variables of calling processes remain visible and are left untouched. Frames stay
+ * allocated once popped, so values left in slots by a previous call are reset in place by typed
+ * copy; a value is cloned only if the slot is empty, of another type, or still referred to
+ * elsewhere. The frame is popped even if execution throws.
  */
 Core::AnyType::Handle Process::execute(Core::ExecutionContext& ioContext) const {
 	schnaps_StackTraceBeginM();
 	SimulationContext& lContext = Core::castObjectT<SimulationContext&>(ioContext);
 	Core::AnyType::Handle lResult;
 	
-	// set process local variables
-	for (unsigned int i = 0; i < mLocalVariables.size(); i++) {
-		lContext.insertLocalVariable(
-			mLocalVariables[i].first,
-			Core::castHandleT<Core::AnyType>(mLocalVariables[i].second->clone()));
+	// push a frame with process local variables
+	std::vector<Core::AnyType::Handle>& lFrame = lContext.pushLocalFrame(mLocalLabels);
+	try {
+		for (unsigned int i = 0; i < mLocalVariables.size(); i++) {
+			const Core::AnyType& lInitial = *mLocalVariables[i].second;
+			if ((lFrame[i] == NULL) || (lFrame[i]->getRefCounter() > 1) || (lFrame[i]->getName() != lInitial.getName())) {
+				lFrame[i] = Core::castHandleT<Core::AnyType>(lInitial.clone());
+			} else {
+				lFrame[i]->copyValue(lInitial);
+			}
+		}
+		lResult = mPrimitiveTree->interpret(ioContext);
+	} catch (...) {
+		lContext.popLocalFrame();
+		throw;
 	}
-	lResult = mPrimitiveTree->interpret(ioContext);
-	lContext.clearLocalVariables();
+	lContext.popLocalFrame();
 	
 	return lResult;
 	schnaps_StackTraceEndM("SCHNAPS::Core::AnyType::Handle SCHNAPS::Simulation::Process::execute(SCHNAPS::Core::ExecutionContext&) const ");
@@ -96,6 +96,7 @@ protected:
 private:
 	Core::PrimitiveTree::Handle mPrimitiveTree;	//!< Primive tree that represents the process execution.
 	std::vector<LocalVariable> mLocalVariables;	//!< Variables local to the process.
+	std::vector<std::string> mLocalLabels;		//!< Labels of local variables, per frame slot.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
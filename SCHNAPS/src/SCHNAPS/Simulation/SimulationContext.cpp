@@ -81,33 +81,58 @@ void SimulationContext::readProcesses(PACC::XML::ConstIterator inIter) {
 	PACC::XML::Document lDocument;
 	std::string lFile;
 
+	// parse external process files in parallel; reading them through the system stays sequential
+	std::vector<std::string> lFiles;
 	for (PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; lChild++) {
-		if (lChild->getType() == PACC::XML::eData) {
-			if (lChild->getValue() != "Process") {
-				std::ostringstream lOSS;
-				lOSS << "tag <Process> expected, but ";
-				lOSS << "got tag <" << lChild->getValue() << "> instead!";
-				throw schnaps_IOExceptionNodeM(*lChild, lOSS.str());
-			}
-			if (lChild->getAttribute("label").empty()) {
-				throw schnaps_IOExceptionNodeM(*lChild, "process label attribute expected!");
-			}
+		if (lChild->getType() == PACC::XML::eData && lChild->getAttribute("file").empty() == false) {
+			lFiles.push_back(lChild->getAttribute("file"));
+		}
+	}
+	std::vector<PACC::XML::Document*> lDocuments;
+	ParsingThread::parse(lFiles, lDocuments, Core::castObjectT<const Core::UInt&>(mSystem->getParameters().getParameter("threads.simulator")).getValue());
+	unsigned int lFileIndex = 0;
+
+	try {
+		for (PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; lChild++) {
+			if (lChild->getType() == PACC::XML::eData) {
+				if (lChild->getValue() != "Process") {
+					std::ostringstream lOSS;
+					lOSS << "tag <Process> expected, but ";
+					lOSS << "got tag <" << lChild->getValue() << "> instead!";
+					throw schnaps_IOExceptionNodeM(*lChild, lOSS.str());
+				}
+				if (lChild->getAttribute("label").empty()) {
+					throw schnaps_IOExceptionNodeM(*lChild, "process label attribute expected!");
+				}
 
 #ifdef SCHNAPS_FULL_DEBUG
 	printf("Reading process %s\n", lChild->getAttribute("label").c_str());
 #endif
 
-			lFile = lChild->getAttribute("file");
-			mProcesses.insert(std::pair<std::string, Process::Handle>(lChild->getAttribute("label"), new Process()));
-			if (lFile.empty()) {
-				mProcesses[lChild->getAttribute("label")]->readWithSystem(lChild, *mSystem);
-			} else {
-				lDocument.parse(lFile);
-				mProcesses[lChild->getAttribute("label")]->readWithSystem(lDocument.getFirstDataTag(), *mSystem);
-			}
+				lFile = lChild->getAttribute("file");
+				mProcesses.insert(std::pair<std::string, Process::Handle>(lChild->getAttribute("label"), new Process()));
+				if (lFile.empty()) {
+					mProcesses[lChild->getAttribute("label")]->readWithSystem(lChild, *mSystem);
+				} else if (lDocuments[lFileIndex] != NULL) {
+					mProcesses[lChild->getAttribute("label")]->readWithSystem(lDocuments[lFileIndex++]->getFirstDataTag(), *mSystem);
+				} else {
+					// not parsed in parallel (single thread or parse error)
+					lFileIndex++;
+					lDocument.parse(lFile);
+					mProcesses[lChild->getAttribute("label")]->readWithSystem(lDocument.getFirstDataTag(), *mSystem);
+				}
 //				mProcesses[lChild->getAttribute("label")]->validate(*this);
-			// TODO: uncomment process validation on read.
+				// TODO: uncomment process validation on read.
+			}
+		}
+	} catch (...) {
+		for (unsigned int i = 0; i < lDocuments.size(); i++) {
+			delete lDocuments[i];
 		}
+		throw;
+	}
+	for (unsigned int i = 0; i < lDocuments.size(); i++) {
+		delete lDocuments[i];
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::readProcesses(PACC::XML::ConstIterator)");
 }
@@ -389,12 +414,95 @@ SimulationContext::Handle SimulationContext::deepCopy() const {
 	}
 	
 	// copy local variables
-	for (LocalVariablesMap::const_iterator lIt = this->mLocalVariables.begin(); lIt != this->mLocalVariables.end(); lIt++) {
-		lCopy->mLocalVariables.insert(std::pair<std::string, Core::AnyType::Handle>(
-			lIt->first.c_str(),
-			Core::castHandleT<Core::AnyType>(lIt->second->clone())));
-	}
+	lCopy->cloneLocalVariables(*this);
 
 	return lCopy;
 	schnaps_StackTraceEndM("SCHNAPS::Simulation::SimulationContext::Handle SCHNAPS::Simulation::SimulationContext::deepCopy() const");
 }
+
+/*!
+ * \brief  Return a handle to a copy of the simulation context that shares its processes, scenarios and clock observers.
+ * \return A handle to a copy of the simulation context.
+ *
+ * Process trees are read-only during simulation (mutable execution state lives in the context), so
+ * the contexts of all simulation threads can share them. Primitives that cache data keep it per
+ * thread (e.g. the alias tables of Data_RouletteDynamic, the slots of the Meds accumulator), or
+ * rebuild it under a lock and publish it atomically (the alias table of Control_BranchMulti).
+ */
+SimulationContext::Handle SimulationContext::sharedCopy() const {
+	schnaps_StackTraceBeginM();
+	SimulationContext::Handle lCopy = new SimulationContext(mSystem, mClock, mEnvironment);
+	lCopy->shareDefinitions(*this);
+	return lCopy;
+	schnaps_StackTraceEndM("SCHNAPS::Simulation::SimulationContext::Handle SCHNAPS::Simulation::SimulationContext::sharedCopy() const");
+}
+
+/*!
+ * \brief Share the processes, scenarios and clock observers of another simulation context.
+ * \param inOriginal A const reference to the original simulation context.
+ */
+void SimulationContext::shareDefinitions(const SimulationContext& inOriginal) {
+	schnaps_StackTraceBeginM();
+	mProcesses = inOriginal.mProcesses;
+	mScenarios = inOriginal.mScenarios;
+	mObserversForEnvironment = inOriginal.mObserversForEnvironment;
+	mObserversForIndividuals = inOriginal.mObserversForIndividuals;
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::shareDefinitions(const SCHNAPS::Simulation::SimulationContext&)");
+}
+
+/*!
+ * \brief Add the clock observers to a schedule shared by all contexts.
+ * \param ioSchedule A reference to the schedule.
+ *
+ * Observers are added in the order of the observer maps; contexts resolve the indexes
+ * of the schedule to processes with SCHNAPS::Simulation::SimulationContext::resetObserversNextExecution.
+ */
+void SimulationContext::compileObservers(ObserverSchedule& ioSchedule) const {
+	schnaps_StackTraceBeginM();
+	ioSchedule.clear();
+	// target environment
+	for (ObserverMap::const_iterator lIt_i = mObserversForEnvironment.begin(); lIt_i != mObserversForEnvironment.end(); lIt_i++) {
+		ioSchedule.insert(lIt_i->first, lIt_i->second.mStart, lIt_i->second.mEnd, lIt_i->second.mStep, lIt_i->second.mUnits, true);
+	}
+	// target all individuals
+	for (ObserverMap::const_iterator lIt_i = mObserversForIndividuals.begin(); lIt_i != mObserversForIndividuals.end(); lIt_i++) {
+		ioSchedule.insert(lIt_i->first, lIt_i->second.mStart, lIt_i->second.mEnd, lIt_i->second.mStep, lIt_i->second.mUnits, false);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::compileObservers(SCHNAPS::Simulation::ObserverSchedule&) const");
+}
+
+/*!
+ * \brief Bind the context to a compiled schedule of clock observers.
+ * \param inSchedule A handle to the schedule, shared by all contexts.
+ * \throw SCHNAPS::Core::AssertException if the schedule is NULL.
+ * \throw SCHNAPS::Core::RunTimeException if a scheduled observer does not exist in this context.
+ */
+void SimulationContext::resetObserversNextExecution(ObserverSchedule::Handle inSchedule) {
+	schnaps_StackTraceBeginM();
+	schnaps_NonNullPointerAssertM(inSchedule);
+	const std::vector<ObserverSchedule::Entry>& lEntries = inSchedule->getEntries();
+	ObserverMap::const_iterator lIt;
+
+	mObserverSchedule = inSchedule;
+	mObserverProcesses.clear();
+	mCurrentObserversForEnvironment.clear();
+	mCurrentObserversForIndividuals.clear();
+	mCurrentObserversForEnvironment.reserve(lEntries.size());
+	mCurrentObserversForIndividuals.reserve(lEntries.size());
+
+	for (unsigned int i = 0; i < lEntries.size(); i++) {
+		if (lEntries[i].mEnvironment) {
+			lIt = mObserversForEnvironment.find(lEntries[i].mLabel);
+			if (lIt == mObserversForEnvironment.end()) {
+				throw schnaps_RunTimeExceptionM("The observer '" + lEntries[i].mLabel + "' that targets the environment does not exist in this context.");
+			}
+		} else {
+			lIt = mObserversForIndividuals.find(lEntries[i].mLabel);
+			if (lIt == mObserversForIndividuals.end()) {
+				throw schnaps_RunTimeExceptionM("The observer '" + lEntries[i].mLabel + "' that targets all individuals does not exist in this context.");
+			}
+		}
+		mObserverProcesses.push_back(lIt->second.mProcess);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::resetObserversNextExecution(SCHNAPS::Simulation::ObserverSchedule::Handle)");
+}
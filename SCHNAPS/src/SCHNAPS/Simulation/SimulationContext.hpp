@@ -25,8 +25,10 @@
 #include "SCHNAPS/Simulation/Clock.hpp"
 #include "SCHNAPS/Simulation/Environment.hpp"
 #include "SCHNAPS/Simulation/Individual.hpp"
+#include "SCHNAPS/Simulation/ObserverSchedule.hpp"
 #include "SCHNAPS/Simulation/Process.hpp"
 
+#include <climits>
 #include <list>
 
 #if defined(SCHNAPS_HAVE_STD_HASHMAP) | defined(SCHNAPS_HAVE_STDEXT_HASHMAP)
@@ -101,7 +103,6 @@ protected:
 	typedef std::map<std::string, Scenario> ScenarioMap; //!< Scenario label to scenario.
 	typedef std::map<std::string, Observer> ObserverMap; //!< Process label to observer that contains the process.
 #endif
-	typedef std::multimap<unsigned long, std::string> ExecutionMap;	//!< Clock tick of the next occurence to process label.
 
 public:
 
@@ -142,6 +143,10 @@ public:
 	void writeScenarios(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
 
 	SimulationContext::Handle deepCopy() const;
+	//! Return a handle to a copy of the simulation context that shares its processes, scenarios and clock observers.
+	SimulationContext::Handle sharedCopy() const;
+	//! Share the processes, scenarios and clock observers of another simulation context.
+	void shareDefinitions(const SimulationContext& inOriginal);
 
 	/*!
 	 * \brief Reset to a null individual and clears the list of push processes.
@@ -153,105 +158,47 @@ public:
 		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::resetIndividual()");
 	}
 
+	//! Add the clock observers to a schedule shared by all contexts.
+	void compileObservers(ObserverSchedule& ioSchedule) const;
+	//! Bind the context to a compiled schedule of clock observers.
+	void resetObserversNextExecution(ObserverSchedule::Handle inSchedule);
+
 	/*!
-	 * \brief Reset to a null individual and clears the list of push processes.
-	 * \throw SCHNAPS::Core::AssertException if the simulation clock has not been defined.
+	 * \brief Update the clock observers at the current time step from the shared schedule.
+	 * \throw SCHNAPS::Core::AssertException if the context is not bound to a schedule.
+	 *
+	 * The schedule must already have been updated for the current time step.
 	 */
-	void resetObserversNextExecution() {
+	void updateCurrentObservers() {
 		schnaps_StackTraceBeginM();
-		schnaps_NonNullPointerAssertM(mClock);
+		schnaps_NonNullPointerAssertM(mObserverSchedule);
+		const std::vector<unsigned int>& lDueForEnvironment = mObserverSchedule->getDueForEnvironment();
+		const std::vector<unsigned int>& lDueForIndividuals = mObserverSchedule->getDueForIndividuals();
+
 		// target environment
 		mCurrentObserversForEnvironment.clear();
-		mObserversForEnvironmentExecution.clear();
-		for (ObserverMap::iterator lIt_i = mObserversForEnvironment.begin(); lIt_i != mObserversForEnvironment.end(); lIt_i++) {
-			mObserversForEnvironmentExecution.insert(std::pair<unsigned long, std::string>(
-				mClock->getTick(lIt_i->second.mStart, lIt_i->second.mUnits),
-				lIt_i->first));
+		for (unsigned int i = 0; i < lDueForEnvironment.size(); i++) {
+			mCurrentObserversForEnvironment.push_back(mObserverProcesses[lDueForEnvironment[i]]);
 		}
-		
+
 		// target all individuals
 		mCurrentObserversForIndividuals.clear();
-		mObserversForIndividualsExecution.clear();
-		for (ObserverMap::iterator lIt_i = mObserversForIndividuals.begin(); lIt_i != mObserversForIndividuals.end(); lIt_i++) {
-			mObserversForIndividualsExecution.insert(std::pair<unsigned long, std::string>(
-				mClock->getTick(lIt_i->second.mStart, lIt_i->second.mUnits),
-				lIt_i->first));
+		for (unsigned int i = 0; i < lDueForIndividuals.size(); i++) {
+			mCurrentObserversForIndividuals.push_back(mObserverProcesses[lDueForIndividuals[i]]);
 		}
-		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::resetObserversNextExecution()");
+		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::updateCurrentObservers()");
 	}
 
 	/*!
-	 * \brief Update the clock observers at the current time step.
-	 * \throw SCHNAPS::Core::AssertException if the simulation clock has not been defined.
+	 * \brief  Return the next clock tick at which an observer must be executed.
+	 * \return The next clock tick after the current one with a due observer, or ULONG_MAX if there is none.
+	 * \throw  SCHNAPS::Core::AssertException if the context is not bound to a schedule.
 	 */
-	void updateCurrentObservers() {
+	unsigned long getNextObserversExecution() const {
 		schnaps_StackTraceBeginM();
-		schnaps_NonNullPointerAssertM(mClock);
-		std::pair<ExecutionMap::iterator, ExecutionMap::iterator> lRange;
-		ObserverMap::iterator lIt_Observer;
-		std::vector<std::pair<unsigned long, std::string> > lUpdateExecution;
-		
-		// target environment
-		lUpdateExecution.clear();
-		mCurrentObserversForEnvironment.clear();
-		// get observers with next occurence equal to current clock value
-		lRange = mObserversForEnvironmentExecution.equal_range(mClock->getValue());
-		for (ExecutionMap::iterator lIt_i = lRange.first; lIt_i != lRange.second; lIt_i++) {
-			lIt_Observer = mObserversForEnvironment.find(lIt_i->second);
-			mCurrentObserversForEnvironment.push_back(lIt_Observer->second.mProcess);
-			
-			// compute next occurence of the process
-			if (lIt_Observer->second.mEnd > 0) {
-				// if there is a end condition
-				if (mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep <= lIt_Observer->second.mEnd) {
-					lUpdateExecution.push_back(std::pair<unsigned long, std::string>(
-						mClock->getTick(mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep, lIt_Observer->second.mUnits),
-						lIt_i->second));
-				}
-			} else {
-				// if there is no end condition
-				lUpdateExecution.push_back(std::pair<unsigned long, std::string>(
-					mClock->getTick(mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep, lIt_Observer->second.mUnits),
-					lIt_i->second));
-			}
-		}
-		// update next occurence of the processes
-		mObserversForEnvironmentExecution.erase(mClock->getValue());
-		for (unsigned int i = 0; i < lUpdateExecution.size(); i++) {
-			mObserversForEnvironmentExecution.insert(lUpdateExecution[i]);
-		}
-		
-		
-		// target all individuals
-		lUpdateExecution.clear();
-		mCurrentObserversForIndividuals.clear();
-		// get observers with next occurence equal to current clock value
-		lRange = mObserversForIndividualsExecution.equal_range(mClock->getValue());
-		for (ExecutionMap::iterator lIt_i = lRange.first; lIt_i != lRange.second; lIt_i++) {
-			lIt_Observer = mObserversForIndividuals.find(lIt_i->second);
-			mCurrentObserversForIndividuals.push_back(lIt_Observer->second.mProcess);
-			
-			// compute next occurence of the process
-			if (lIt_Observer->second.mEnd > 0) {
-				// if there is a end condition
-				if (mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep <= lIt_Observer->second.mEnd) {
-					lUpdateExecution.push_back(std::pair<unsigned long, std::string>(
-						mClock->getTick(mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep, lIt_Observer->second.mUnits),
-						lIt_i->second));
-				}
-			} else {
-				// if there is no end condition
-				lUpdateExecution.push_back(std::pair<unsigned long, std::string>(
-					mClock->getTick(mClock->getValue(lIt_Observer->second.mUnits) + lIt_Observer->second.mStep, lIt_Observer->second.mUnits),
-					lIt_i->second));
-			}
-		}
-		// update next occurence of the processes
-		mObserversForIndividualsExecution.erase(mClock->getValue());
-		for (unsigned int i = 0; i < lUpdateExecution.size(); i++) {
-			mObserversForIndividualsExecution.insert(lUpdateExecution[i]);
-		}
-		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationContext::updateCurrentObserversForEnvironment()");
+		schnaps_NonNullPointerAssertM(mObserverSchedule);
+		return mObserverSchedule->getNextExecution();
+		schnaps_StackTraceEndM("unsigned long SCHNAPS::Simulation::SimulationContext::getNextObserversExecution() const");
 	}
 
 	/*!
@@ -358,9 +305,9 @@ private:
 	ScenarioMap mScenarios;							//!< Scenario processes (label to scenario).
 	ObserverMap mObserversForEnvironment;			//!< Clock observers that target the environment (next occurence in clock units to observer).
 	ObserverMap mObserversForIndividuals;			//!< Clock observers that target all individuals (next occurence in clock units to observer).
-	
-	ExecutionMap mObserversForEnvironmentExecution;	
-	ExecutionMap mObserversForIndividualsExecution;
+
+	ObserverSchedule::Handle mObserverSchedule;		//!< Compiled schedule of clock observers, shared by all contexts.
+	Process::Bag mObserverProcesses;				//!< Observing processes of this context (schedule index to process).
 	Process::Bag mCurrentObserversForEnvironment;	//!< Clock observers that target the environment to trigger at current time step.
 	Process::Bag mCurrentObserversForIndividuals;	//!< Clock observers that target all individuals to trigger at current time step.
 
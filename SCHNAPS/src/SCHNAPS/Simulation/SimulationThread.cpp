@@ -35,7 +35,8 @@ SimulationThread::SimulationThread(PACC::Threading::Condition* inParallel,
 	mBlackBoardWrt(inBlackBoardWrt),
 	mContext(inContext),
 	mBlackBoard(inBlackBoard),
-	mWaitingQMaps(inWaitingQMaps)
+	mWaitingQMaps(inWaitingQMaps),
+	mSubStep(0)
 {
 	run();
 }
@@ -55,6 +56,7 @@ void SimulationThread::main() {
 	do {
 		switch (mPosition) {
 		case eSTEP:
+			mEraseIndexes.clear();
 			if (mIndexes.size() > 0) {
 				Simulator::processClockStep(this);
 			}
@@ -76,16 +76,29 @@ public:
 	 * \brief Add new indexes of individuals to simulate between specific bounds, according to the current thread ID and the total number of threads.
 	 * \param inLowerBound The lower bound of indexes.
 	 * \param inUpperBound The upper bound of indexes.
+	 *
+	 * Indexes are dealt cyclically, or in contiguous blocks when parameter "threads.contiguous" is set
+	 * (so that neighbours in a reordered contact graph are mostly simulated by the same thread).
 	 */
 	void addNewIndexes(unsigned int inLowerBound, unsigned int inUpperBound) {
 		schnaps_StackTraceBeginM();
 		unsigned int lThreadNb = mContext->getThreadNb();
 		unsigned int lNbThreads = Core::castObjectT<const Core::UInt&>(mContext->getSystem().getParameters().getParameter("threads.simulator")).getValue();
+		bool lContiguous = Core::castObjectT<const Core::Bool&>(mContext->getSystem().getParameters().getParameter("threads.contiguous")).getValue();
 
-		for (unsigned int i = inLowerBound; i < inUpperBound; i++) {
-			if (i % lNbThreads == lThreadNb) {
+		if (lContiguous) {
+			unsigned long lSize = inUpperBound - inLowerBound;
+			unsigned int lBegin = inLowerBound + lSize * lThreadNb / lNbThreads;
+			unsigned int lEnd = inLowerBound + lSize * (lThreadNb+1) / lNbThreads;
+			for (unsigned int i = lBegin; i < lEnd; i++) {
 				mNewIndexes.push_back(i);
 			}
+		} else {
+			for (unsigned int i = inLowerBound; i < inUpperBound; i++) {
+				if (i % lNbThreads == lThreadNb) {
+					mNewIndexes.push_back(i);
+				}
+			}
 		}
 		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationThread::addNewIndexes(unsigned int, unsigned int)");
 	}
@@ -110,6 +123,16 @@ public:
 		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationThread::setPosition(SCHNAPS::Simulation::SimulationThread::Position)");
 	}
 
+	/*!
+	 * \brief Set the number of the current sub-step in the time step.
+	 * \param inSubStep The number of the current sub-step (0 for the step itself).
+	 */
+	void setSubStep(unsigned int inSubStep) {
+		schnaps_StackTraceBeginM();
+		mSubStep = inSubStep;
+		schnaps_StackTraceEndM("void SCHNAPS::Simulation::SimulationThread::setSubStep(unsigned int)");
+	}
+
 	/*!
 	 * \brief Reset the indexes of individuals to simulate.
 	 */
@@ -186,6 +209,16 @@ public:
 		schnaps_StackTraceEndM("std::list<unsigned int>& SCHNAPS::Simulation::SimulationThread::getEraseIndexes()");
 	}
 
+	/*!
+	 * \brief  Return the number of the current sub-step in the time step.
+	 * \return The number of the current sub-step in the time step.
+	 */
+	unsigned int getSubStep() const {
+		schnaps_StackTraceBeginM();
+		return mSubStep;
+		schnaps_StackTraceEndM("unsigned int SCHNAPS::Simulation::SimulationThread::getSubStep() const");
+	}
+
 	/*!
 	 * \brief  Return a const reference to the label of scenario to simulate.
 	 * \return A const reference to the label of scenario to simulate.
@@ -214,6 +247,7 @@ private:
 
 	std::string mScenarioLabel;					//!< The label of scenario to simulate.
 	Position mPosition;							//!< The position of threads in execution.
+	unsigned int mSubStep;						//!< The number of the current sub-step in the time step.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
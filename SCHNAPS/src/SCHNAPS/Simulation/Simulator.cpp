@@ -21,6 +21,8 @@
 #include "SCHNAPS/Core.hpp"
 #include "SCHNAPS/Simulation.hpp"
 
+#include <algorithm>
+
 using namespace SCHNAPS;
 using namespace Simulation;
 
@@ -34,6 +36,7 @@ Simulator::Simulator() :
 	mPopulationManager(new PopulationManager(mSystem, mClock, mEnvironment)),
 	mBlackBoard(new BlackBoard()),
 	mWaitingQMaps(new WaitingQMaps()),
+	mObserverSchedule(new ObserverSchedule()),
 	mParallel(new PACC::Threading::Condition()),
 	mSequential(new PACC::Threading::Semaphore(0)),
 	mBlackBoardWrt(new PACC::Threading::Semaphore(1))
@@ -53,9 +56,16 @@ Simulator::Simulator() :
 	mSystem->getParameters().insertParameter("print.output", new Core::Bool(true));
 	mSystem->getParameters().insertParameter("print.log", new Core::Bool(true));
 	mSystem->getParameters().insertParameter("print.conf", new Core::Bool(false));
+	mSystem->getParameters().insertParameter("print.release", new Core::Bool(false));
+	mSystem->getParameters().insertParameter("print.spill", new Core::Bool(false));
 	mSystem->getParameters().insertParameter("threads.simulator", new Core::UInt(1));
 	mSystem->getParameters().insertParameter("threads.generator", new Core::UInt(1));
+	mSystem->getParameters().insertParameter("threads.contiguous", new Core::Bool(false));
+	mSystem->getParameters().insertParameter("clock.skip", new Core::Bool(false));
+	mSystem->getParameters().insertParameter("randomizer.counter", new Core::Bool(false));
+	mSystem->getParameters().insertParameter("generator.block", new Core::UInt(0));
 	mSystem->getParameters().insertParameter("contacts.variable", new Core::String("liste_contacts"));
+	mSystem->getParameters().insertParameter("contacts.reorder", new Core::String("none"));
 	
 	// create default context
 	mContext.push_back(new SimulationContext(mSystem, mClock, mEnvironment));
@@ -149,6 +159,128 @@ std::string Simulator::getConfiguration() {
 	schnaps_StackTraceEndM("std::string SCHNAPS::Simulation::Simulator::getConfiguration()");
 }
 
+/*!
+ * \brief Read a configuration file and write the fully loaded model to a cache file.
+ * \param inConfigurationFile A const reference to the name of configuration file.
+ * \param inCacheFile A const reference to the name of cache file.
+ * \throw SCHNAPS::Core::RunTimeException if the cache file cannot be opened or read back.
+ *
+ * The cache holds the whole model in a single document, with every referenced file (processes,
+ * demography, environment, population) inlined, along with a stamp of the size and content of
+ * each file it depends on, including the loaded plugin libraries. The written cache is read back
+ * by a new simulator, and removed if that fails.
+ *
+ * The model is still stored as XML and read back through the factory, since XML is the only
+ * serialization implemented by every primitive, including those of plugins. What the cache saves
+ * is resolving, decompressing and parsing the referenced files one by one.
+ */
+void Simulator::compile(const std::string& inConfigurationFile, const std::string& inCacheFile) {
+	schnaps_StackTraceBeginM();
+	PACC::XML::Document lDocument;
+	lDocument.parse(inConfigurationFile);
+	read(lDocument.getFirstDataTag());
+
+	// list files the model depends on
+	std::vector<std::string> lDependencies(1, inConfigurationFile);
+	listDependencies(lDocument.getFirstDataTag(), lDependencies);
+	mSystem->getPlugins().listPaths(lDependencies);
+
+	std::ofstream lOFS(inCacheFile.c_str(), std::ios::out);
+	if (!lOFS) {
+		std::ostringstream lOSS;
+		lOSS << "The cache file '" << inCacheFile << "' could not be opened; ";
+		lOSS << "could not compile the model.";
+		throw schnaps_RunTimeExceptionM(lOSS.str());
+	}
+
+	PACC::XML::Streamer lStreamer(lOFS);
+	lStreamer.openTag("ModelCache");
+	lStreamer.insertAttribute("version", SCHNAPS_MODELCACHE_VERSION);
+	for (unsigned int i = 0; i < lDependencies.size(); i++) {
+		lStreamer.openTag("Dependency");
+		lStreamer.insertAttribute("file", lDependencies[i]);
+		lStreamer.insertAttribute("stamp", getFileStamp(lDependencies[i]));
+		lStreamer.closeTag();
+	}
+	write(lStreamer, false);
+	lStreamer.closeTag();
+	lOFS.close();
+
+	// check that the cache reads back
+	try {
+		Simulator lCheck;
+		if (lCheck.readCacheFile(inCacheFile) == false) {
+			std::ostringstream lOSS;
+			lOSS << "The cache file '" << inCacheFile << "' could not be read back; ";
+			lOSS << "could not compile the model.";
+			throw schnaps_RunTimeExceptionM(lOSS.str());
+		}
+	} catch (...) {
+		std::remove(inCacheFile.c_str());
+		throw;
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::compile(const std::string&, const std::string&)");
+}
+
+/*!
+ * \brief  Read the model from a cache file, if it is up to date.
+ * \param  inCacheFile A const reference to the name of cache file.
+ * \return True if the model was read from cache, false if the cache is missing, out of date or invalid.
+ *
+ * A cache is out of date when it was written by another version, or when the size or content
+ * of any of the files it depends on has changed since. Nothing is read in that case. When reading
+ * the cache fails, the simulator may be partly configured and must not be used.
+ */
+bool Simulator::readCache(const std::string& inCacheFile) {
+	schnaps_StackTraceBeginM();
+	try {
+		return readCacheFile(inCacheFile);
+	} catch (...) {
+		// any failure falls back to the configuration file
+		return false;
+	}
+	schnaps_StackTraceEndM("bool SCHNAPS::Simulation::Simulator::readCache(const std::string&)");
+}
+
+/*!
+ * \brief  Read the model from a cache file, if it is up to date.
+ * \param  inCacheFile A const reference to the name of cache file.
+ * \return True if the model was read from cache, false if the cache is missing or out of date.
+ * \throw  SCHNAPS::Core::IOException if the cache cannot be read.
+ */
+bool Simulator::readCacheFile(const std::string& inCacheFile) {
+	schnaps_StackTraceBeginM();
+	if (std::ifstream(inCacheFile.c_str()).good() == false) {
+		return false;
+	}
+
+	PACC::XML::Document lDocument;
+	lDocument.parse(inCacheFile);
+	PACC::XML::ConstIterator lRoot = lDocument.getFirstDataTag();
+	if (!lRoot || lRoot->getValue() != "ModelCache") {
+		return false;
+	}
+	if (lRoot->getAttribute("version") != SCHNAPS::uint2str(SCHNAPS_MODELCACHE_VERSION)) {
+		return false;
+	}
+
+	PACC::XML::ConstIterator lChild = lRoot->getFirstChild();
+	for (; lChild && (lChild->getType() != PACC::XML::eData || lChild->getValue() == "Dependency"); lChild++) {
+		if (lChild->getType() == PACC::XML::eData) {
+			if (getFileStamp(lChild->getAttribute("file")) != lChild->getAttribute("stamp")) {
+				return false;
+			}
+		}
+	}
+	if (!lChild) {
+		return false;
+	}
+
+	read(lChild);
+	return true;
+	schnaps_StackTraceEndM("bool SCHNAPS::Simulation::Simulator::readCacheFile(const std::string&)");
+}
+
 /*!
  * \brief Execute the simulation of specific scenario.
  * \param inScenarioLabel A const reference to the label of scenario to simulate.
@@ -160,16 +292,19 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 	mEnvironment->reset();
 	mPopulationManager->getPrefixes().clear();
 	mBlackBoard->clear();
-	mWaitingQMaps->getEnvironmentWaitingQMap().clear();
-	mWaitingQMaps->getIndividualsWaitingQMaps().clear();
+	mWaitingQMaps->clear();
+	mSystem->resetComponents();
+
+	// compile clock observers once for all contexts
+	mContext[0]->compileObservers(*mObserverSchedule);
+	mObserverSchedule->reset(*mClock);
 
-	// backup randomizer seeds
-	Core::ULongArray lBackupSeed;
-	Core::StringArray lBackupState;
+	// backup randomizer states
+	std::vector<Core::Randomizer::State> lBackupState(mContext.size());
 	
 	for (unsigned int i = 0; i < mContext.size(); i++) {
 		mContext[i]->resetIndividual();
-		mContext[i]->resetObserversNextExecution();
+		mContext[i]->resetObserversNextExecution(mObserverSchedule);
 		
 		// create subthreads
 		mSubThreads.push_back(new SimulationThread(mParallel, mSequential, mBlackBoardWrt, mContext[i], mBlackBoard, mWaitingQMaps));
@@ -178,15 +313,21 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 		mSubThreads.back()->setScenarioLabel(inScenarioLabel);
 
 		// reset randomizer info
-		lBackupSeed.push_back(mSystem->getRandomizer(i).getSeed());
-		lBackupState.push_back(mSystem->getRandomizer(i).getState());
-		mSystem->getRandomizer(i).reset(mRandomizerCurrentSeed[i], mRandomizerCurrentState[i]);
+		mSystem->getRandomizer(i).saveState(lBackupState[i]);
+		mSystem->getRandomizer(i).loadState(mRandomizerCurrentState[i]);
+	}
+
+	// draw from streams of individuals instead of streams of threads if asked
+	bool lCounterBased = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("randomizer.counter")).getValue();
+	for (unsigned int i = 0; i < mContext.size(); i++) {
+		mSystem->getRandomizer(i).setCounterBased(lCounterBased, mRandomizerCurrentState[0].mSeed);
 	}
 
 	// current position in simulation
 	enum Position {eSTEP, eSUBSTEP};
 	Position lPositionEnv;
 	bool lSubStep;
+	unsigned int lSubStepNb;
 
 	// population index bounds
 	unsigned int lNewIndividuals_LowerBound = 0;
@@ -196,9 +337,17 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 	bool lPrintInput = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("print.input")).getValue();
 	bool lPrintOutput = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("print.output")).getValue();
 	bool lPrintLog = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("print.log")).getValue();
+	bool lPrintRelease = lPrintOutput && Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("print.release")).getValue();
+	bool lPrintSpill = lPrintRelease && Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("print.spill")).getValue();
+	bool lSkipIdle = Core::castObjectT<const Core::Bool&>(mSystem->getParameters().getParameter("clock.skip")).getValue();
+	std::string lSpillFile = lPrintPrefix + "Spill.tmp";
 	ogzstream lOGZS;
 	std::stringstream lSS;
 
+	if (lPrintSpill) {
+		mSpill.open(lSpillFile);
+	}
+
 	if (lPrintInput) {
 		lSS.str("");
 		lSS << lPrintPrefix << "Input.gz";
@@ -217,12 +366,13 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 		}
 	}
 
-	do { // while (mClock->step(*mContext[0]))
+	do { // while (stepClock(lSkipIdle))
 #ifdef SCHNAPS_FULL_DEBUG
 		std::cout << "Time " << mClock->getValue() << "\n";
 #endif
 
 		lPositionEnv = eSTEP;
+		mObserverSchedule->update(*mClock);
 		for (unsigned int i = 0; i < mSubThreads.size(); i++) {
 			mSubThreads[i]->setPosition(SimulationThread::eSTEP);
 			mContext[i]->updateCurrentObservers();
@@ -249,6 +399,7 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 			lNewIndividuals_LowerBound = mEnvironment->getPopulation().size();
 		}
 
+		lSubStepNb = 0;
 		do {
 			lSubStep = false;
 
@@ -256,6 +407,7 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 			std::cout << "Processing environment\n";
 #endif
 			mContext[0]->setIndividual(mEnvironment);
+			mContext[0]->getRandomizer().setStream(SCHNAPS_RANDOMIZER_GLOBAL_STREAM, mClock->getValue(), lSubStepNb);
 			switch (lPositionEnv) {
 			case eSTEP:
 				if (mClock->getValue() == 0) {
@@ -305,14 +457,12 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 						break;
 					case Process::eIndividuals:
 						for (std::map<unsigned int, std::map<unsigned int, std::queue<Process::Handle> > >::iterator lIt_i = mWaitingQMaps->getIndividualsWaitingQMaps().begin(); lIt_i != mWaitingQMaps->getIndividualsWaitingQMaps().end(); lIt_i++) {
-							(lIt_i->second)[mContext[0]->getPushList().front().mTime].push(new ProcessPushed(mContext[0]->getPushList().front().mProcess));
+							mWaitingQMaps->pushIndividual(lIt_i->first, mContext[0]->getPushList().front().mTime, new ProcessPushed(mContext[0]->getPushList().front().mProcess));
 						}
 						break;
 					case Process::eIndividualByID: //en test
 //						std::cout << "process pushed by env" << std::endl;
-						if (mEnvironment->getPopulation()[mContext[0]->getPushList().front().mTargetID]->isActive()){ //check that individual is not idle
-							mWaitingQMaps->getIndividualsWaitingQMaps()[mContext[0]->getPushList().front().mTargetID][mContext[0]->getPushList().front().mTime].push(new ProcessPushed(mContext[0]->getPushList().front().mProcess));
-						}
+						pushByID(mContext[0]->getPushList().front());
 						break;
 					default:
 						throw schnaps_InternalExceptionM("Undefined process target!");
@@ -326,6 +476,9 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 			std::cout << "Processing individuals\n";
 #endif
 			// process individuals
+			for (unsigned int i = 0; i < mSubThreads.size(); i++) {
+				mSubThreads[i]->setSubStep(lSubStepNb);
+			}
 			mParallel->lock();
 			mParallel->broadcast();
 			mParallel->unlock();
@@ -337,6 +490,11 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 			for (unsigned int i = 0; i < mSubThreads.size(); i++) {
 				for (std::list<unsigned int>::iterator lIt_i = mSubThreads[i]->getEraseIndexes().begin(); lIt_i != mSubThreads[i]->getEraseIndexes().end(); lIt_i++) {
 					mWaitingQMaps->getIndividualsWaitingQMaps().erase(*lIt_i);
+					
+					// release idle individual state if asked
+					if (lPrintRelease) {
+						releaseIndividual(*lIt_i);
+					}
 				}
 			}
 
@@ -348,7 +506,7 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 				while (lIt_i->second.empty() == false) {
 					switch (lIt_i->second.front().mTarget) {
 					case Process::eCurrent:
-						mWaitingQMaps->getIndividualsWaitingQMaps()[lIt_i->first][lIt_i->second.front().mTime].push(
+						mWaitingQMaps->pushIndividual(lIt_i->first, lIt_i->second.front().mTime,
 								new ProcessPushed(lIt_i->second.front().mProcess));
 						break;
 					case Process::eEnvironment:
@@ -357,20 +515,12 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 						break;
 					case Process::eIndividuals:
 						for (std::map<unsigned int, std::map<unsigned int, std::queue<Process::Handle> > >::iterator lIt_j = mWaitingQMaps->getIndividualsWaitingQMaps().begin(); lIt_j != mWaitingQMaps->getIndividualsWaitingQMaps().end(); lIt_j++) {
-							(lIt_j->second)[mContext[0]->getPushList().front().mTime].push(new ProcessPushed(mContext[0]->getPushList().front().mProcess));
+							mWaitingQMaps->pushIndividual(lIt_j->first, mContext[0]->getPushList().front().mTime, new ProcessPushed(mContext[0]->getPushList().front().mProcess));
 						}
 						break;
 					case Process::eIndividualByID: //en test
 //						std::cout << "process pushed by individual " << lIt_i->first << " to individual " << lIt_i->second.front().mTargetID << " time " << lIt_i->second.front().mTime << std::endl;
-						if (mEnvironment->getPopulation()[lIt_i->second.front().mTargetID]->isActive()){ //check that individual is not idle
-							mWaitingQMaps->getIndividualsWaitingQMaps()[lIt_i->second.front().mTargetID][lIt_i->second.front().mTime].push(new ProcessPushed(lIt_i->second.front().mProcess));
-						}
-#ifdef SCHNAPS_FULL_DEBUG
-
-						else{
-							std::cout << "individus inactif " << std::endl;
-						}
-#endif
+						pushByID(lIt_i->second.front());
 						break;
 					default:
 						throw schnaps_InternalExceptionM("Undefined process target!");
@@ -380,8 +530,9 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 				} // while (lIt->second.empty() == false
 			} // for each BlackBoard::PushTracker
 			mBlackBoard->clear();
+			lSubStepNb++;
 		} while (lSubStep == true);
-	} while (mClock->step(*mContext[0]) && mEnvironment->isActive());
+	} while (stepClock(lSkipIdle) && mEnvironment->isActive());
 	
 	// terminate threads
 	for (unsigned int i = 0; i < mSubThreads.size(); i++) {
@@ -393,9 +544,9 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 
 	// reset randomizers old info
 	for (unsigned int i = 0; i < mSubThreads.size(); i++) {
-		mRandomizerCurrentSeed[i] = mSystem->getRandomizer(i).getSeed();
-		mRandomizerCurrentState[i] = mSystem->getRandomizer(i).getState();
-		mSystem->getRandomizer(i).reset(lBackupSeed[i], lBackupState[i]);
+		mSystem->getRandomizer(i).saveState(mRandomizerCurrentState[i]);
+		mSystem->getRandomizer(i).loadState(lBackupState[i]);
+		mSystem->getRandomizer(i).setCounterBased(false);
 	}
 
 	// close log files
@@ -423,6 +574,11 @@ void Simulator::simulate(const std::string& inScenarioLabel) {
 		lOGZS.close();
 	}
 
+	// remove spill file
+	if (lPrintSpill) {
+		mSpill.close();
+	}
+
 	// print summary
 	if (lPrintInput || lPrintOutput) {
 		lSS.str("");
@@ -458,9 +614,8 @@ void Simulator::refresh() {
 	// create one context per thread
 	if (lNbThreads_new > lNbThreads_old) {
 		for (unsigned int i = lNbThreads_old; i < lNbThreads_new; i++) {
-			// create new context as copy of the first one to copy process map
-			// TODO: does the simulator should own an original copy of the process map? 
-			mContext.push_back(mContext[0]->deepCopy());
+			// create new context that shares the (read-only) processes of the first one
+			mContext.push_back(mContext[0]->sharedCopy());
 			mContext.back()->setThreadNb(i);
 			
 			// add simulator randomizer information
@@ -479,8 +634,7 @@ void Simulator::refresh() {
 	}
 	
 	// update simulator randomizers information
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	resetRandomizer();
 	
 	// refresh individual generator
 	mPopulationManager->getGenerator().refresh();
@@ -495,9 +649,8 @@ void Simulator::refresh() {
  */
 void Simulator::clearRandomizer() {
 	schnaps_StackTraceBeginM();
-	for (unsigned int i = 0; i < mRandomizerCurrentSeed.size(); i++) {
-		mRandomizerCurrentSeed[i] = 0;
-		mRandomizerCurrentState[i] = "";
+	for (unsigned int i = 0; i < mRandomizerCurrentState.size(); i++) {
+		Core::Randomizer::parseState(0, "", mRandomizerCurrentState[i]);
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::clearRandomizer()");
 }
@@ -507,11 +660,30 @@ void Simulator::clearRandomizer() {
  */
 void Simulator::resetRandomizer() {
 	schnaps_StackTraceBeginM();
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	mRandomizerCurrentState.resize(mRandomizerInitSeed.size());
+	for (unsigned int i = 0; i < mRandomizerInitSeed.size(); i++) {
+		Core::Randomizer::parseState(mRandomizerInitSeed[i], mRandomizerInitState[i], mRandomizerCurrentState[i]);
+	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::resetRandomizer()");
 }
 
+/*!
+ * \brief Seed randomizers (one per thread) from a single seed.
+ * \param inSeed The seed (0 for a random seed per randomizer).
+ *
+ * Each randomizer gets a distinct seed derived from the single seed, so that a run is reproducible
+ * from one number. With per-thread randomizers, draws depend on how individuals are split among
+ * threads, so results are the same only for the same threads.simulator; with randomizer.counter,
+ * draws are keyed by individual and tick and do not depend on the number of threads.
+ */
+void Simulator::seedRandomizer(unsigned long inSeed) {
+	schnaps_StackTraceBeginM();
+	for (unsigned int i = 0; i < mRandomizerCurrentState.size(); i++) {
+		Core::Randomizer::parseState(inSeed == 0 ? 0 : inSeed * 0x9E3779B9UL + i, "", mRandomizerCurrentState[i]);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::seedRandomizer(unsigned long)");
+}
+
 /*!
  * \brief Scenario processing by a specific thread.
  * \param inThread A handle to the executing thread.
@@ -524,8 +696,6 @@ void Simulator::processScenario(SimulationThread::Handle inThread) {
 	
 	std::list<unsigned int>& lNewIndexes = inThread->getNewIndexes();
 	std::list<unsigned int>& lEraseIndexes = inThread->getEraseIndexes();
-	
-	lEraseIndexes.clear();
 
 	// if there is a scenario for individuals
 	if (lContext.getScenario(inThread->getScenarioLabel()).mProcessIndividual != NULL) {
@@ -535,6 +705,7 @@ void Simulator::processScenario(SimulationThread::Handle inThread) {
 			lIndividual = lContext.getEnvironment().getPopulation()[*lIt_i];
 			
 			lContext.setIndividual(lIndividual);
+			lContext.getRandomizer().setStream(*lIt_i, lContext.getClock().getValue(), inThread->getSubStep());
 			
 			// process scenario
 			lContext.getScenario(inThread->getScenarioLabel()).mProcessIndividual->execute(lContext);
@@ -573,14 +744,13 @@ void Simulator::processClockStep(SimulationThread::Handle inThread) {
 	std::list<unsigned int>& lIndexes = inThread->getIndexes();
 	std::list<unsigned int>& lEraseIndexes = inThread->getEraseIndexes();
 	std::map<unsigned int, std::map<unsigned int, std::queue<Process::Handle> > >& lIndividualWaitingQMaps = inThread->getWaitingQMaps().getIndividualsWaitingQMaps();
-	
-	lEraseIndexes.clear();
 
 	std::list<unsigned int>::iterator lIt_i = lIndexes.begin();
 	while (lIt_i != lIndexes.end()) {
 		lIndividual = lContext.getEnvironment().getPopulation()[*lIt_i];
 		
 		lContext.setIndividual(lIndividual);
+		lContext.getRandomizer().setStream(*lIt_i, lContext.getClock().getValue(), inThread->getSubStep());
 		
 		// process clock observers
 		for (unsigned int j = 0; j < lContext.getCurrentObserversForIndividuals().size(); j++) {
@@ -639,6 +809,7 @@ void Simulator::processSubStep(SimulationThread::Handle inThread) {
 		lIndividual = lContext.getEnvironment().getPopulation()[*lIt_i];
 		
 		lContext.setIndividual(lIndividual);
+		lContext.getRandomizer().setStream(*lIt_i, lContext.getClock().getValue(), inThread->getSubStep());
 		
 		// process current individual FIFO
 		while ((lIndividualWaitingQMaps[*lIt_i][lContext.getClock().getValue()].empty() == false) && (lIndividual->isActive())) {
@@ -728,19 +899,18 @@ void Simulator::readSimulation(PACC::XML::ConstIterator inIter) {
 	// read clock
 	mClock->readWithSystem(lChild++, *mSystem);
 
-	PACC::XML::ConstIterator lChildSubThread;
+	// read processes
+	mContext[0]->readProcesses(lChild++);
 
-	for (unsigned int i = 0; i < mContext.size(); i++) {
-		lChildSubThread = lChild;
+	// read scenarios
+	mContext[0]->readScenarios(lChild++);
 
-		// read processes
-		mContext[i]->readProcesses(lChildSubThread++);
+	// read observers
+	mContext[0]->readObservers(lChild);
 
-		// read scenarios
-		mContext[i]->readScenarios(lChildSubThread++);
-
-		// read observers
-		mContext[i]->readObservers(lChildSubThread);
+	// share processes, scenarios and observers with the contexts of other threads
+	for (unsigned int i = 1; i < mContext.size(); i++) {
+		mContext[i]->shareDefinitions(*mContext[0]);
 	}
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::readSimulation(PACC::XML::ConstIterator)");
 }
@@ -814,8 +984,7 @@ void Simulator::readRandomizerInfo(PACC::XML::ConstIterator inIter) {
 	    }
 	}
 
-	mRandomizerCurrentSeed = mRandomizerInitSeed;
-	mRandomizerCurrentState = mRandomizerInitState;
+	resetRandomizer();
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::readRandomizerInfo(PACC::XML::ConstIterator)");
 }
 
@@ -913,6 +1082,73 @@ void Simulator::readPopulationOutput(PACC::XML::ConstIterator inIter) {
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::readPopulationOutput(PACC::XML::ConstIterator)");
 }
 
+/*!
+ * \brief Append the files referred to by a configuration node to a list of dependencies.
+ * \param inIter XML iterator of configuration node.
+ * \param ioDependencies A reference to the list of dependencies.
+ *
+ * Referred files are scanned in turn, so that files nested in other files are also listed.
+ */
+void Simulator::listDependencies(PACC::XML::ConstIterator inIter, std::vector<std::string>& ioDependencies) {
+	schnaps_StackTraceBeginM();
+	if (inIter->getType() != PACC::XML::eData) {
+		return;
+	}
+
+	const std::string& lFile = inIter->getAttribute("file");
+	if (lFile.empty() == false && std::find(ioDependencies.begin(), ioDependencies.end(), lFile) == ioDependencies.end()) {
+		ioDependencies.push_back(lFile);
+
+		// population files may be compressed
+		igzstream lIGZS;
+		lIGZS.open(lFile.c_str(), std::ios::in);
+		PACC::XML::Document lDocument;
+		lDocument.parse(lIGZS);
+		lIGZS.close();
+		for (PACC::XML::ConstIterator lRoot = lDocument.getFirstRoot(); lRoot; lRoot++) {
+			listDependencies(lRoot, ioDependencies);
+		}
+	}
+
+	for (PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; lChild++) {
+		listDependencies(lChild, ioDependencies);
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::listDependencies(PACC::XML::ConstIterator, std::vector<std::string>&)");
+}
+
+/*!
+ * \brief  Return a stamp of the size and content of a file.
+ * \param  inFile A const reference to the name of file.
+ * \return The size and 64-bit FNV-1a hash of file content, or an empty string if the file cannot be read.
+ *
+ * Content is hashed rather than relying on modification times, which may have a granularity
+ * of one second or more and miss quick edits.
+ */
+std::string Simulator::getFileStamp(const std::string& inFile) {
+	schnaps_StackTraceBeginM();
+	std::ifstream lIFS(inFile.c_str(), std::ios::in | std::ios::binary);
+	if (!lIFS) {
+		return "";
+	}
+
+	unsigned long long lSize = 0;
+	unsigned long long lHash = 14695981039346656037ULL;
+	char lBuffer[65536];
+	while (lIFS.read(lBuffer, sizeof(lBuffer)) || lIFS.gcount() > 0) {
+		const std::streamsize lCount = lIFS.gcount();
+		for (std::streamsize i = 0; i < lCount; i++) {
+			lHash ^= static_cast<unsigned char>(lBuffer[i]);
+			lHash *= 1099511628211ULL;
+		}
+		lSize += lCount;
+	}
+
+	std::ostringstream lOSS;
+	lOSS << lSize << ":" << std::hex << lHash;
+	return lOSS.str();
+	schnaps_StackTraceEndM("std::string SCHNAPS::Simulation::Simulator::getFileStamp(const std::string&)");
+}
+
 /*!
  * \brief Write input section to configuration file.
  */
@@ -1026,6 +1262,13 @@ void Simulator::printIndividuals(std::ostream& ioStream, unsigned int inLowerInd
 
 	for (unsigned int i = inLowerIndex; i < inUpperIndex+1; i++) {
 		lIndividual = mEnvironment->getPopulation()[i];
+		
+		// copy back output of released individual from spill file
+		if (lIndividual->isReleased() && (lIndividual->getSpillOffset() >= 0)) {
+			mSpill.copy(lIndividual->getSpillOffset(), lIndividual->getSpillSize(), ioStream);
+			continue;
+		}
+		
 		if (lIndividual->getID().find(lPrefix) == std::string::npos) {
 			lPrefix = lIndividual->getPrefix();
 			lSubPopulationIt = mOutputParameters.mPopulation.find(mPopulationManager->getPrefixes().find(lPrefix)->second.mProfile);
@@ -1078,3 +1321,83 @@ void Simulator::printSummary(std::ostream& ioStream) const {
 	ioStreamer.closeTag();
 	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::printSummary(std::ostream&) const");
 }
+
+/*!
+ * \brief Serialize the output of an idle individual and release its state.
+ * \param inIndex The index of individual in population.
+ */
+void Simulator::releaseIndividual(unsigned int inIndex) {
+	schnaps_StackTraceBeginM();
+	Individual::Handle lIndividual = mEnvironment->getPopulation()[inIndex];
+	if (lIndividual->isReleased() == false) {
+		if (mSpill.isOpen()) {
+			lIndividual->release(getOutputVariables(lIndividual->getPrefix()), &mSpill);
+		} else {
+			lIndividual->release(getOutputVariables(lIndividual->getPrefix()));
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::releaseIndividual(unsigned int)");
+}
+
+/*!
+ * \brief  Step the clock to the next tick to simulate.
+ * \param  inSkipIdle True to jump directly to the next tick with a waiting process, a due observer or new individuals.
+ * \return True if the simulation continues, false if the clock stop condition was encountered.
+ */
+bool Simulator::stepClock(bool inSkipIdle) {
+	schnaps_StackTraceBeginM();
+	if (inSkipIdle == false) {
+		return mClock->step(*mContext[0]);
+	}
+	
+	unsigned long lNextTick = std::min(mWaitingQMaps->getNextTime(mClock->getValue()), mContext[0]->getNextObserversExecution());
+	PopulationManager::const_iterator lIt = mPopulationManager->upper_bound(mClock->getValue());
+	if (lIt != mPopulationManager->end() && lIt->first < lNextTick) {
+		lNextTick = lIt->first;
+	}
+	return mClock->stepTo(lNextTick, *mContext[0]);
+	schnaps_StackTraceEndM("bool SCHNAPS::Simulation::Simulator::stepClock(bool)");
+}
+
+/*!
+ * \brief Push a process to specific individuals, skipping idle ones.
+ * \param inPush A const reference to the push, holding a single target ID or a batch of them.
+ */
+void Simulator::pushByID(const Push& inPush) {
+	schnaps_StackTraceBeginM();
+	// a pushed process only holds its label, so one instance is shared by the whole batch
+	Process::Handle lProcess = new ProcessPushed(inPush.mProcess);
+	if (inPush.mTargetIDs.empty()) {
+		if (mEnvironment->getPopulation()[inPush.mTargetID]->isActive()) { //check that individual is not idle
+			mWaitingQMaps->pushIndividual(inPush.mTargetID, inPush.mTime, lProcess);
+		}
+#ifdef SCHNAPS_FULL_DEBUG
+		else {
+			std::cout << "individus inactif " << std::endl;
+		}
+#endif
+	} else {
+		for (unsigned int i = 0; i < inPush.mTargetIDs.size(); i++) {
+			if (mEnvironment->getPopulation()[inPush.mTargetIDs[i]]->isActive()) { //check that individual is not idle
+				mWaitingQMaps->pushIndividual(inPush.mTargetIDs[i], inPush.mTime, lProcess);
+			}
+		}
+	}
+	schnaps_StackTraceEndM("void SCHNAPS::Simulation::Simulator::pushByID(const SCHNAPS::Simulation::Push&)");
+}
+
+/*!
+ * \brief  Return a const reference to the output variables of a sub-population.
+ * \param  inPrefix A const reference to the sub-population prefix.
+ * \return A const reference to the output variables of the sub-population.
+ * \throw  SCHNAPS::Core::IOException if the sub-population output variables are missing.
+ */
+const std::vector<std::string>& Simulator::getOutputVariables(const std::string& inPrefix) const {
+	schnaps_StackTraceBeginM();
+	std::map<std::string, std::vector<std::string> >::const_iterator lSubPopulationIt = mOutputParameters.mPopulation.find(mPopulationManager->getPrefixes().find(inPrefix)->second.mProfile);
+	if (lSubPopulationIt == mOutputParameters.mPopulation.end()) {
+		throw schnaps_IOExceptionMessageM("Missing outcome variables in XML");
+	}
+	return lSubPopulationIt->second;
+	schnaps_StackTraceEndM("const std::vector<std::string>& SCHNAPS::Simulation::Simulator::getOutputVariables(const std::string&) const");
+}
@@ -25,15 +25,25 @@
 #include "SCHNAPS/Simulation/BlackBoard.hpp"
 #include "SCHNAPS/Simulation/Clock.hpp"
 #include "SCHNAPS/Simulation/Environment.hpp"
+#include "SCHNAPS/Simulation/MappedFile.hpp"
+#include "SCHNAPS/Simulation/ObserverSchedule.hpp"
 #include "SCHNAPS/Simulation/Process.hpp"
 #include "SCHNAPS/Simulation/SimulationContext.hpp"
 #include "SCHNAPS/Simulation/WaitingQMaps.hpp"
 #include "SCHNAPS/Simulation/SimulationThread.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <map>
 #include <queue>
 #include <vector>
 
+/*!
+ * \def   SCHNAPS_MODELCACHE_VERSION
+ * \brief Version of model cache files; caches of another version are ignored.
+ */
+#define SCHNAPS_MODELCACHE_VERSION 2
+
 namespace SCHNAPS {
 namespace Simulation {
 
@@ -88,6 +98,11 @@ public:
 	//! Return the current simulator configuration.
 	std::string getConfiguration();
 
+	//! Read a configuration file and write the fully loaded model to a cache file.
+	void compile(const std::string& inConfigurationFile, const std::string& inCacheFile);
+	//! Read the model from a cache file, if it is up to date.
+	bool readCache(const std::string& inCacheFile);
+
 	//! Execute the simulation of scpecific scenario.
 	void simulate(const std::string& inScenarioLabel);
 	
@@ -97,6 +112,8 @@ public:
 	void clearRandomizer();
 	//! Reset the randomizer values for seeds and states to initial values.
 	void resetRandomizer();
+	//! Seed randomizers (one per thread) from a single seed.
+	void seedRandomizer(unsigned long inSeed);
 
 	//! Return a const pointer to the system.
 	const Core::System::Handle getSystemHandle() const {
@@ -177,6 +194,13 @@ private:
 	//! Read population information in output section of configuration file.
 	void readPopulationOutput(PACC::XML::ConstIterator inIter);
 
+	//! Read the model from a cache file if it is up to date, throwing on invalid cache.
+	bool readCacheFile(const std::string& inCacheFile);
+	//! Append the files referred to by a configuration node to a list of dependencies.
+	static void listDependencies(PACC::XML::ConstIterator inIter, std::vector<std::string>& ioDependencies);
+	//! Return a stamp of the size and content of a file.
+	static std::string getFileStamp(const std::string& inFile);
+
 	// sub writes
 	//! Write input section to configuration file.
 	void writeInput(PACC::XML::Streamer& ioStreamer, bool inIndent = true) const;
@@ -200,6 +224,15 @@ private:
 	//! Print the summary that describes the output variables and order.
 	void printSummary(std::ostream& ioStream) const;
 
+	//! Serialize the output of an idle individual and release its state.
+	void releaseIndividual(unsigned int inIndex);
+	//! Step the clock to the next tick to simulate.
+	bool stepClock(bool inSkipIdle);
+	//! Push a process to specific individuals.
+	void pushByID(const Push& inPush);
+	//! Return a const reference to the output variables of a sub-population.
+	const std::vector<std::string>& getOutputVariables(const std::string& inPrefix) const;
+
 private:
 	// system structures
 	Core::System::Handle mSystem;				 	//!< Handle to system.
@@ -211,11 +244,11 @@ private:
 
 	BlackBoard::Handle mBlackBoard;					//!< Handle to blackboard for push tracking.
 	WaitingQMaps::Handle mWaitingQMaps;				//!< Handle to environment and individuals waiting queues.
+	ObserverSchedule::Handle mObserverSchedule;		//!< Handle to compiled schedule of clock observers, shared by all contexts.
 
 	Core::ULongArray mRandomizerInitSeed;			//!< Init registered seed of random number generators (one per thread).
 	Core::StringArray mRandomizerInitState;			//!< Init state of random number generators (one per thread).
-	Core::ULongArray mRandomizerCurrentSeed;		//!< Current registered seed of random number generators (one per thread).
-	Core::StringArray mRandomizerCurrentState;		//!< Current state of random number generators (one per thread).
+	std::vector<Core::Randomizer::State> mRandomizerCurrentState;	//!< Current seed and state of random number generators (one per thread).
 
 	SimulationContext::Bag mContext;				//!< All simulation contexts (1 per thread).
 
@@ -226,6 +259,7 @@ private:
 	PACC::Threading::Semaphore* mBlackBoardWrt;		//!< Thread semaphore for modifying blackboard.
 
 	OutputParameters mOutputParameters;				//!< Output parameters.
+	MappedFile mSpill;								//!< Memory-mapped spill file for output of released individuals.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
@@ -40,4 +40,35 @@ WaitingQMaps::WaitingQMaps(const WaitingQMaps& inOriginal) {
 			mIndividuals[lIt_i->first][lIt_j->first] = lIt_j->second;
 		}
 	}
+	
+	mIndividualsSchedule = inOriginal.mIndividualsSchedule;
+}
+
+/*!
+ * \brief  Return the next time step with a process waiting for the environment or an individual.
+ * \param  inCurrentTime The current time step.
+ * \return The next time step after current one with a waiting process, or ULONG_MAX if there is none.
+ *
+ * Time steps of individual pushes are kept even if the individual has been set idle since,
+ * so the returned time step may have nothing left to process, but no time step with waiting processes is missed.
+ */
+unsigned long WaitingQMaps::getNextTime(unsigned long inCurrentTime) {
+	schnaps_StackTraceBeginM();
+	unsigned long lNextTime = ULONG_MAX;
+	
+	// environment FIFOs
+	for (std::map<unsigned int, std::queue<Process::Handle> >::const_iterator lIt = mEnvironment.upper_bound(inCurrentTime); lIt != mEnvironment.end(); lIt++) {
+		if (lIt->second.empty() == false) {
+			lNextTime = lIt->first;
+			break;
+		}
+	}
+	
+	// individuals FIFOs (past time steps are forgotten)
+	mIndividualsSchedule.erase(mIndividualsSchedule.begin(), mIndividualsSchedule.upper_bound(inCurrentTime));
+	if (mIndividualsSchedule.empty() == false && *mIndividualsSchedule.begin() < lNextTime) {
+		lNextTime = *mIndividualsSchedule.begin();
+	}
+	return lNextTime;
+	schnaps_StackTraceEndM("unsigned long SCHNAPS::Simulation::WaitingQMaps::getNextTime(unsigned long)");
 }
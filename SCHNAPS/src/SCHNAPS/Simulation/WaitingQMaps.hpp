@@ -24,8 +24,10 @@
 #include "SCHNAPS/Core/Object.hpp"
 #include "SCHNAPS/Simulation/Process.hpp"
 
+#include <climits>
 #include <map>
 #include <queue>
+#include <set>
 #include <vector>
 
 namespace SCHNAPS {
@@ -71,9 +73,33 @@ public:
 		return mIndividuals;
 	}
 
+	/*!
+	 * \brief Push a process in the FIFO of a specific individual at a specific time.
+	 * \param inIndex The index of the individual.
+	 * \param inTime The time step of process execution.
+	 * \param inProcess A handle to the process.
+	 */
+	void pushIndividual(unsigned int inIndex, unsigned int inTime, Process::Handle inProcess) {
+		mIndividuals[inIndex][inTime].push(inProcess);
+		mIndividualsSchedule.insert(inTime);
+	}
+
+	//! Return the next time step with a process waiting for the environment or an individual.
+	unsigned long getNextTime(unsigned long inCurrentTime);
+
+	/*!
+	 * \brief Remove all waiting processes.
+	 */
+	void clear() {
+		mEnvironment.clear();
+		mIndividuals.clear();
+		mIndividualsSchedule.clear();
+	}
+
 private:
 	std::map<unsigned int, std::queue<Process::Handle> > mEnvironment;							//!< FIFOs for environment.
 	std::map<unsigned int, std::map<unsigned int, std::queue<Process::Handle> > > mIndividuals;	//!< FIFOs for each individual.
+	std::set<unsigned int> mIndividualsSchedule;												//!< Time steps where processes have been pushed to individuals.
 };
 } // end of Simulation namespace
 } // end of SCHNAPS namespace
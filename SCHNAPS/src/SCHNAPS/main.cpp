@@ -42,12 +42,14 @@ int main(int argc, char* argv[]) {
 		std::string lConfigurationFile = "";
 		std::string lParameters = "";
 		std::string lScenario = "";
+		std::string lCacheFile = "";
+		bool lCompile = false;
 
 #ifdef SCHNAPS_FULL_DEBUG
 		std::cout << "Argument parsing\n";
 #endif
 
-		while ((lOpt = getopt(argc, argv, "d:c:s:p:")) != -1) {
+		while ((lOpt = getopt(argc, argv, "d:c:s:p:m:C")) != -1) {
 			switch (lOpt) {
 			case 'd':
 				lDirectory.assign(optarg);
@@ -61,6 +63,12 @@ int main(int argc, char* argv[]) {
 			case 's':
 				lScenario.assign(optarg);
 				break;
+			case 'm':
+				lCacheFile.assign(optarg);
+				break;
+			case 'C':
+				lCompile = true;
+				break;
 			case '?':
 				std::cerr << "Missing argument of option -" << optopt << ".\n";
 				break;
@@ -80,15 +88,20 @@ int main(int argc, char* argv[]) {
 			lOSS << "could not parse it.";
 			schnaps_RunTimeExceptionM(lOSS.str());
 		}
+
+		// model cache defaults to a file next to the configuration file
+		if (lCacheFile.empty()) {
+			lCacheFile = lConfigurationFile + ".cache";
+		}
 		
-		if (lScenario.empty()) {
+		if (lScenario.empty() && lCompile == false) {
 			std::stringstream lOSS;
 			lOSS << "The given scenario is empty; ";
 			lOSS << "could not simulate it.";
 			schnaps_RunTimeExceptionM(lOSS.str());
 		}
 
-		Simulation::Simulator lSimulator;
+		Simulation::Simulator::Handle lSimulator = new Simulation::Simulator();
 
 		// set current working directory
 		if (lDirectory.empty() == false) {
@@ -96,28 +109,41 @@ int main(int argc, char* argv[]) {
 			schnaps_AssertM(lChdir == 0);
 		}
 
-		// configure simulator from file
+		// compile model to cache and exit
+		if (lCompile) {
+#ifdef SCHNAPS_FULL_DEBUG
+			std::cout << "Compile model to cache\n";
+#endif
+			lSimulator->compile(lConfigurationFile, lCacheFile);
+			return 0;
+		}
+
+		// configure simulator from up-to-date cache, or else from file
 #ifdef SCHNAPS_FULL_DEBUG
 		std::cout << "Configure from file\n";
 #endif
-		PACC::XML::Document *lDocument = new PACC::XML::Document();
-		lDocument->parse(lConfigurationFile);
-		lSimulator.read(lDocument->getFirstDataTag());
-		delete lDocument;
+		if (lSimulator->readCache(lCacheFile) == false) {
+			// start over, the cache may have been partly read
+			lSimulator = new Simulation::Simulator();
+			PACC::XML::Document *lDocument = new PACC::XML::Document();
+			lDocument->parse(lConfigurationFile);
+			lSimulator->read(lDocument->getFirstDataTag());
+			delete lDocument;
+		}
 
 		// command-line parameters override configuration file.
 		if (lParameters.empty() == false) {
 #ifdef SCHNAPS_FULL_DEBUG
 			std::cout << "Configure from command line\n";
 #endif
-			lSimulator.configure(lParameters);
+			lSimulator->configure(lParameters);
 		}
 
 #ifdef SCHNAPS_FULL_DEBUG
 		std::cout << "Simulating\n";
 #endif
 		// simulate
-		lSimulator.simulate(lScenario);
+		lSimulator->simulate(lScenario);
 #ifdef SCHNAPS_FULL_DEBUG
 		std::cout << "Simulating done\n";
 #endif